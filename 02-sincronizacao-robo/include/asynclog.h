@@ -0,0 +1,85 @@
+#ifndef ASYNCLOG_H
+#define ASYNCLOG_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+// --- Configuração ---
+#define ASYNC_LOG_CAPACITY 1024     // Registros por anel (potência de 2)
+#define ASYNC_LOG_MAX_VALUES 12     // Colunas por registro
+#define ASYNC_LOG_MAX_STREAMS 8     // Produtores por logger
+#define ASYNC_LOG_FLUSH_MS 100      // Intervalo entre os lotes do escritor
+
+// --- Estruturas de Dados ---
+// Registro de tamanho fixo: uma linha do log, ainda em binário. A formatação
+// (texto) fica para a thread escritora.
+typedef struct {
+    int n_values;
+    double values[ASYNC_LOG_MAX_VALUES];
+} LogRecord;
+
+// Anel SPSC de um produtor (uma tarefa) para a thread escritora. O produtor
+// só escreve head e o escritor só escreve tail; cada um fica na sua linha de
+// cache. Com o anel cheio o registro é descartado e contado: a tarefa nunca
+// espera pelo disco.
+typedef struct {
+    _Alignas(64) atomic_uint_fast64_t head; // Próximo registro a produzir
+    _Alignas(64) atomic_uint_fast64_t tail; // Próximo registro a gravar
+    _Alignas(64) uint64_t dropped;          // Registros descartados (anel cheio; só o produtor escreve)
+    uint64_t high_water;                    // Maior ocupação vista pelo produtor
+    const char* name;
+    FILE* file;                             // Destino (aberto e fechado pelo chamador)
+    uint64_t written;                       // Registros gravados (só o escritor escreve)
+    LogRecord slots[ASYNC_LOG_CAPACITY];
+} LogStream;
+
+// Logger assíncrono: N anéis e uma thread escritora de baixa prioridade
+// (SCHED_OTHER) que drena todos a cada ASYNC_LOG_FLUSH_MS e faz um fflush por lote.
+typedef struct {
+    LogStream streams[ASYNC_LOG_MAX_STREAMS];
+    int n_streams;
+    atomic_int running;
+    int started;
+    pthread_t writer;
+    uint64_t batches;        // Lotes com pelo menos um registro
+    uint64_t max_batch;      // Maior lote (registros numa passada)
+} AsyncLogger;
+
+// --- Protótipos das Funções ---
+
+// Cria um logger vazio (sem anéis e sem escritor). Retorna NULL em caso de falha.
+AsyncLogger* create_async_logger(void);
+
+/**
+ * @brief Registra um produtor; deve ser chamada antes de async_logger_start().
+ * @param logger O logger.
+ * @param name Nome do produtor, para o relatório.
+ * @param file Arquivo de destino, já aberto (o cabeçalho pode ser escrito antes).
+ * @return O anel do produtor ou NULL se não houver espaço.
+ */
+LogStream* async_logger_add_stream(AsyncLogger* logger, const char* name, FILE* file);
+
+// Inicia a thread escritora. Retorna 0 ou -1 em caso de falha.
+int async_logger_start(AsyncLogger* logger);
+
+/**
+ * @brief Enfileira um registro sem bloquear (apenas um produtor por anel).
+ * @param stream O anel do produtor.
+ * @param values As colunas da linha.
+ * @param n_values Número de colunas (até ASYNC_LOG_MAX_VALUES).
+ * @return 0 em caso de sucesso, -1 se o anel estava cheio (registro descartado).
+ */
+int async_log_push(LogStream* stream, const double* values, int n_values);
+
+// Para a thread escritora depois de gravar tudo o que restou nos anéis.
+void async_logger_stop(AsyncLogger* logger);
+
+// Imprime, por produtor, registros gravados, descartados e a marca d'água do anel.
+void async_logger_print_stats(const AsyncLogger* logger);
+
+// Para o escritor, se necessário, e libera o logger (os arquivos não são fechados).
+void free_async_logger(AsyncLogger* logger);
+
+#endif // ASYNCLOG_H
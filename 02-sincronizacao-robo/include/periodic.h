@@ -0,0 +1,42 @@
+#ifndef PERIODIC_H
+#define PERIODIC_H
+
+#include <time.h>
+#include "histogram.h"
+
+// --- Estrutura de Dados ---
+// Liberação periódica com instantes absolutos em CLOCK_MONOTONIC: o próximo
+// instante é sempre o anterior + período, então o tempo de computação e a
+// latência de despertar não se acumulam como deriva.
+typedef struct {
+    long period_ns;                  // Período nominal em nanossegundos
+    struct timespec next_release;    // Próximo instante de liberação (absoluto)
+    struct timespec last_release;    // Instante de liberação do job corrente
+    long jobs;                       // Número de jobs liberados
+    Histogram latency_ns;            // Latência liberação -> início (sem o primeiro job, de aquecimento)
+} PeriodicTask;
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Inicializa a tarefa periódica; a primeira liberação é o instante atual.
+ * @param task A estrutura da tarefa.
+ * @param period_s O período nominal em segundos.
+ */
+void periodic_init(PeriodicTask* task, double period_s);
+
+/**
+ * @brief Dorme até a próxima liberação (clock_nanosleep com TIMER_ABSTIME),
+ * registra a latência entre a liberação e o início do job e agenda a seguinte.
+ * @param task A estrutura da tarefa.
+ */
+void periodic_wait_next(PeriodicTask* task);
+
+/**
+ * @brief Imprime a distribuição (percentis) da latência liberação -> início.
+ * @param task_name Nome da tarefa para o cabeçalho.
+ * @param task A estrutura da tarefa.
+ */
+void periodic_print_latency_stats(const char* task_name, const PeriodicTask* task);
+
+#endif // PERIODIC_H
@@ -0,0 +1,21 @@
+#ifndef TEXTWIDTH_H
+#define TEXTWIDTH_H
+
+// --- Largura de Texto UTF-8 ---
+// O printf preenche "%-12s" por bytes: "Mínimo" (7 bytes, 6 colunas) fica uma
+// coluna mais curto que "p50". Estas funções contam colunas exibidas (um
+// caractere por sequência UTF-8; não há caracteres largos nos textos usados).
+
+// Número de colunas exibidas do texto.
+int text_display_width(const char* text);
+
+/**
+ * @brief Largura de campo em bytes para alinhar o texto em 'width' colunas
+ * exibidas, para uso com "%-*s" (ex.: printf("%-*s", text_field_width(s, 12), s)).
+ * @param text O texto UTF-8.
+ * @param width Largura desejada em colunas.
+ * @return A largura a passar ao printf.
+ */
+int text_field_width(const char* text, int width);
+
+#endif // TEXTWIDTH_H
@@ -0,0 +1,99 @@
+#define _GNU_SOURCE // Habilita sincos() da glibc
+
+#include <math.h>
+#include "fastmath.h"
+
+// --- Constantes da redução de argumento ---
+// pi/2 dividido em três partes (Cody-Waite, constantes do fdlibm). As duas
+// primeiras têm 33 bits significativos, de modo que q * PIO2_1 e q * PIO2_2
+// são exatos para |q| < 2^20.
+#define TWO_OVER_PI 6.36619772367581382433e-01
+#define PIO2_1 1.57079632673412561417e+00
+#define PIO2_2 6.07710050630396597660e-11
+#define PIO2_3 2.02226624871116645580e-21
+
+// Constante para arredondar ao inteiro mais próximo sem chamar rint()
+// (1.5 * 2^52): somar e subtrair força o arredondamento da FPU.
+#define ROUND_MAGIC 6755399441055744.0
+
+// Coeficientes de Taylor de sin(r) e cos(r) para |r| <= pi/4.
+#define S1 -1.66666666666666666667e-01 // -1/3!
+#define S2  8.33333333333333333333e-03 //  1/5!
+#define S3 -1.98412698412698412698e-04 // -1/7!
+#define S4  2.75573192239858906526e-06 //  1/9!
+#define S5 -2.50521083854417187751e-08 // -1/11!
+#define C2  4.16666666666666666667e-02 //  1/4!
+#define C3 -1.38888888888888888889e-03 // -1/6!
+#define C4  2.48015873015873015873e-05 //  1/8!
+#define C5 -2.75573192239858906526e-07 // -1/10!
+#define C6  2.08767569878680989792e-09 //  1/12!
+
+// Núcleo polinomial: reduz x ao intervalo [-pi/4, pi/4] e reconstrói o
+// resultado pelo quadrante. Escrito sem desvios para vetorizar em lote.
+static inline void sincos_kernel(double x, double* s, double* c) {
+    double q = (x * TWO_OVER_PI + ROUND_MAGIC) - ROUND_MAGIC;
+    int quadrant = (int) q;
+    double r = ((x - q * PIO2_1) - q * PIO2_2) - q * PIO2_3;
+    double r2 = r * r;
+
+    double sr = r + r * r2 * (S1 + r2 * (S2 + r2 * (S3 + r2 * (S4 + r2 * S5))));
+    double cr = 1.0 - 0.5 * r2 + r2 * r2 * (C2 + r2 * (C3 + r2 * (C4 + r2 * (C5 + r2 * C6))));
+
+    // Quadrante ímpar troca seno e cosseno; os bits seguintes definem os sinais.
+    // Tudo em aritmética (sem ?:) para que o laço em lote não tenha desvios.
+    double swap = (double) (quadrant & 1);
+    double sin_sign = (double) (1 - (quadrant & 2));
+    double cos_sign = (double) (1 - ((quadrant + 1) & 2));
+
+    *s = sin_sign * (sr + swap * (cr - sr));
+    *c = cos_sign * (cr + swap * (sr - cr));
+}
+
+// Implementação via libm: uma única chamada calcula seno e cosseno.
+void fast_sincos_libm(double x, double* s, double* c) {
+    sincos(x, s, c);
+}
+
+// Implementação polinomial com erro limitado (fallback para a libm fora do domínio).
+void fast_sincos_poly(double x, double* s, double* c) {
+    if (fabs(x) > FASTMATH_POLY_MAX_ARG) {
+        sincos(x, s, c);
+        return;
+    }
+    sincos_kernel(x, s, c);
+}
+
+// Lote via libm.
+void fast_sincos_batch_libm(const double* x, double* s, double* c, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        sincos(x[i], &s[i], &c[i]);
+    }
+}
+
+// Lote polinomial: o primeiro laço não tem desvios (vetorizável) e o segundo
+// corrige os raros elementos fora do domínio da redução.
+void fast_sincos_batch_poly(const double* restrict x, double* restrict s, double* restrict c, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        sincos_kernel(x[i], &s[i], &c[i]);
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (fabs(x[i]) > FASTMATH_POLY_MAX_ARG) sincos(x[i], &s[i], &c[i]);
+    }
+}
+
+// Seleção da implementação padrão do projeto.
+void fast_sincos(double x, double* s, double* c) {
+#ifdef FASTMATH_POLY
+    fast_sincos_poly(x, s, c);
+#else
+    fast_sincos_libm(x, s, c);
+#endif
+}
+
+void fast_sincos_batch(const double* x, double* s, double* c, size_t n) {
+#ifdef FASTMATH_POLY
+    fast_sincos_batch_poly(x, s, c, n);
+#else
+    fast_sincos_batch_libm(x, s, c, n);
+#endif
+}
@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "histogram.h"
+
+#define HISTOGRAM_MAX_VALUE ((1ULL << HISTOGRAM_MAX_EXP) - 1)
+
+// Índice da faixa de um valor: linear abaixo de 2^SUB_BITS; acima, grupo pelo
+// expoente e faixa pelos SUB_BITS seguintes ao bit mais significativo.
+static int bucket_index(uint64_t value) {
+    if (value < HISTOGRAM_SUB_COUNT) return (int) value;
+    int exponent = 63 - __builtin_clzll(value);
+    int sub = (int) ((value >> (exponent - HISTOGRAM_SUB_BITS)) & (HISTOGRAM_SUB_COUNT - 1));
+    return (exponent - HISTOGRAM_SUB_BITS + 1) * HISTOGRAM_SUB_COUNT + sub;
+}
+
+// Implementação dos limites da faixa 'index'.
+uint64_t histogram_bucket_lower(int index) {
+    if (index < HISTOGRAM_SUB_COUNT) return (uint64_t) index;
+    int group = index / HISTOGRAM_SUB_COUNT;
+    int sub = index % HISTOGRAM_SUB_COUNT;
+    return (uint64_t) (HISTOGRAM_SUB_COUNT + sub) << (group - 1);
+}
+
+uint64_t histogram_bucket_upper(int index) {
+    if (index < HISTOGRAM_SUB_COUNT) return (uint64_t) index;
+    int shift = index / HISTOGRAM_SUB_COUNT - 1;
+    return histogram_bucket_lower(index) + (1ULL << shift) - 1;
+}
+
+// Implementação da inicialização.
+void histogram_init(Histogram* hist) {
+    memset(hist, 0, sizeof(*hist));
+    hist->min = UINT64_MAX;
+}
+
+// Implementação do registro.
+void histogram_record(Histogram* hist, uint64_t value) {
+    if (value > HISTOGRAM_MAX_VALUE) value = HISTOGRAM_MAX_VALUE;
+    hist->counts[bucket_index(value)]++;
+    hist->count++;
+    hist->sum += value;
+    if (value < hist->min) hist->min = value;
+    if (value > hist->max) hist->max = value;
+
+    // Welford: atualiza média e m2 com o desvio antes e depois da nova média.
+    double delta = (double) value - hist->mean;
+    hist->mean += delta / hist->count;
+    hist->m2 += delta * ((double) value - hist->mean);
+}
+
+// Implementação do percentil.
+uint64_t histogram_percentile(const Histogram* hist, double p) {
+    if (hist->count == 0) return 0;
+    if (p >= 100.0) return hist->max;
+    return histogram_value_at_rank(hist, (uint64_t) (p / 100.0 * hist->count));
+}
+
+// Implementação da posição: percorre as faixas até passar de 'rank' amostras.
+uint64_t histogram_value_at_rank(const Histogram* hist, uint64_t rank) {
+    if (hist->count == 0) return 0;
+    if (rank == 0) return hist->min;
+    if (rank >= hist->count - 1) return hist->max;
+    uint64_t seen = 0;
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        seen += hist->counts[i];
+        if (seen > rank) {
+            uint64_t upper = histogram_bucket_upper(i);
+            if (upper > hist->max) upper = hist->max;
+            if (upper < hist->min) upper = hist->min;
+            return upper;
+        }
+    }
+    return hist->max;
+}
+
+// Implementação da média.
+double histogram_mean(const Histogram* hist) {
+    return hist->count ? (double) hist->sum / hist->count : 0.0;
+}
+
+// Implementação da variância.
+double histogram_variance(const Histogram* hist) {
+    return hist->count ? hist->m2 / hist->count : 0.0;
+}
+
+double histogram_stddev(const Histogram* hist) {
+    return sqrt(histogram_variance(hist));
+}
+
+// Implementação da agregação (média e m2 combinados pela fórmula de Chan).
+void histogram_merge(Histogram* dst, const Histogram* src) {
+    if (src->count == 0) return;
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++) dst->counts[i] += src->counts[i];
+    double n = (double) dst->count + (double) src->count;
+    double delta = src->mean - dst->mean;
+    dst->m2 += src->m2 + delta * delta * ((double) dst->count * (double) src->count / n);
+    dst->mean += delta * ((double) src->count / n);
+    dst->count += src->count;
+    dst->sum += src->sum;
+    if (src->min < dst->min) dst->min = src->min;
+    if (src->max > dst->max) dst->max = src->max;
+}
+
+// Implementação do resumo em ms.
+void histogram_print_ms(const Histogram* hist, const char* max_note) {
+    if (hist->count == 0) return;
+    printf("  - Mínimo: %f ms\n", hist->min / 1e6);
+    printf("  - Médio:  %f ms (desvio padrão %f ms)\n", hist->mean / 1e6, histogram_stddev(hist) / 1e6);
+    printf("  - p50 / p90 / p99 / p99.9: %f / %f / %f / %f ms\n", histogram_percentile(hist, 50.0) / 1e6,
+           histogram_percentile(hist, 90.0) / 1e6, histogram_percentile(hist, 99.0) / 1e6,
+           histogram_percentile(hist, 99.9) / 1e6);
+    if (max_note != NULL) {
+        printf("  - Máximo: %f ms (%s)\n", hist->max / 1e6, max_note);
+    } else {
+        printf("  - Máximo: %f ms\n", hist->max / 1e6);
+    }
+}
+
+// Implementação da inicialização dos desvios.
+void deviation_init(DeviationHistogram* dev) {
+    histogram_init(&dev->below);
+    histogram_init(&dev->above);
+}
+
+// Implementação do registro de um desvio.
+void deviation_record(DeviationHistogram* dev, int64_t deviation) {
+    if (deviation < 0) {
+        histogram_record(&dev->below, (uint64_t) -deviation);
+    } else {
+        histogram_record(&dev->above, (uint64_t) deviation);
+    }
+}
+
+// Implementação do percentil com sinal: em ordem crescente vêm primeiro os
+// desvios negativos (do maior módulo para o menor), depois os positivos.
+int64_t deviation_percentile(const DeviationHistogram* dev, double p) {
+    uint64_t n_below = dev->below.count;
+    uint64_t count = n_below + dev->above.count;
+    if (count == 0) return 0;
+    uint64_t rank = p >= 100.0 ? count - 1 : (uint64_t) (p / 100.0 * count);
+    if (rank >= count) rank = count - 1;
+    if (rank < n_below) return -(int64_t) histogram_value_at_rank(&dev->below, n_below - 1 - rank);
+    return (int64_t) histogram_value_at_rank(&dev->above, rank - n_below);
+}
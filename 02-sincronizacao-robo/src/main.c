@@ -9,20 +9,25 @@
 #include <math.h>
 
 #include "robot.h"
-
-#define MAX_SAMPLES 700
+#include "periodic.h"
+#include "asynclog.h"
+#include "histogram.h"
+#include "textwidth.h"
 
 // --- Variáveis Globais Compartilhadas ---
 RobotState* g_robot_state;
 pthread_mutex_t g_robot_mutex;
 volatile int g_simulation_running = 1;
 volatile int g_load_thread_running = 1; // Flag para a nova thread de carga
+AsyncLogger* g_logger;    // Log assíncrono: a thread de controle só enfileira
+LogStream* g_log_stream;  // Anel da thread de controle/IO
 
 // --- Protótipos das Funções das Threads ---
-void* thread_controle_io(void* filename_arg);
+void* thread_controle_io(void* arg);
 void* thread_simulacao(void* arg);
 void* thread_carga(void* arg);
-void calculate_and_print_stats(double periods_ms[], int count, double nominal_period_ms);
+void calculate_and_print_stats(const Histogram* periods_ns, const DeviationHistogram* jitter_ns,
+                               double nominal_period_ms);
 
 // --- Função Principal ---
 int main(int argc, char *argv[]) {
@@ -51,9 +56,22 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
+    // O arquivo é aberto aqui; a thread escritora (SCHED_OTHER) grava os registros em lotes.
+    FILE* out_file = fopen(output_filename, "w");
+    if (out_file == NULL) {
+        perror("Erro ao criar o arquivo de saida em data/");
+        return 1;
+    }
+    fprintf(out_file, "t(s) v(m/s) w(rad/s) Xc(m) Yc(m) theta(rad) Xf(m) Yf(m)\n");
+    g_logger = create_async_logger();
+    if (g_logger == NULL || (g_log_stream = async_logger_add_stream(g_logger, "Controle/IO", out_file)) == NULL ||
+        async_logger_start(g_logger) != 0) {
+        fprintf(stderr, "Erro ao iniciar o log assíncrono.\n");
+        return 1;
+    }
+
     pthread_t tid1, tid2, tid_carga;
-    // Passa o nome do arquivo como argumento para a thread de controle/IO
-    pthread_create(&tid1, NULL, thread_controle_io, (void*)output_filename);
+    pthread_create(&tid1, NULL, thread_controle_io, NULL);
     pthread_create(&tid2, NULL, thread_simulacao, NULL);
     if (run_with_load) {
         pthread_create(&tid_carga, NULL, thread_carga, NULL);
@@ -74,6 +92,11 @@ int main(int argc, char *argv[]) {
     if (run_with_load) {
         pthread_join(tid_carga, NULL);
     }
+    async_logger_stop(g_logger); // Grava o que restou no anel antes de fechar o arquivo
+    fclose(out_file);
+    printf("Dados salvos em %s\n", output_filename);
+    async_logger_print_stats(g_logger);
+    free_async_logger(g_logger);
 
     // Libera os recursos
     pthread_mutex_destroy(&g_robot_mutex);
@@ -100,34 +123,35 @@ void* thread_carga(void* arg) {
 /**
  * @brief Thread 1: Gera u(t), lê y(t), armazena dados e mede performance.
  */
-void* thread_controle_io(void* filename_arg) {
-    const char* output_filename = (const char*)filename_arg;
+void* thread_controle_io(void* arg) {
+    (void)arg;
     printf("Thread de Controle/IO (30ms) iniciada.\n");
 
-    FILE* out_file = fopen(output_filename, "w");
-    if (out_file == NULL) {
-        perror("Erro ao criar o arquivo de saida em data/");
-        g_simulation_running = 0;
-        return NULL;
-    }
-    fprintf(out_file, "t(s) v(m/s) w(rad/s) Xc(m) Yc(m) theta(rad) Xf(m) Yf(m)\n");
-
     double simulation_time = 0.0;
     const double dt = 0.030;
 
+    // Período e jitter em memória constante: execuções de qualquer duração.
     struct timespec last_time, current_time;
-    double periods_ms[MAX_SAMPLES];
-    int sample_count = 0;
+    Histogram periods_ns;
+    DeviationHistogram jitter_ns;
+    int first_job = 1; // O primeiro intervalo parte da inicialização, não de um job
+    histogram_init(&periods_ns);
+    deviation_init(&jitter_ns);
+    PeriodicTask timer;
+    periodic_init(&timer, dt);
     clock_gettime(CLOCK_MONOTONIC, &last_time);
 
     while (g_simulation_running) {
+        periodic_wait_next(&timer);
         clock_gettime(CLOCK_MONOTONIC, &current_time);
-        double elapsed_ms = (current_time.tv_sec - last_time.tv_sec) * 1000.0 +
-                            (current_time.tv_nsec - last_time.tv_nsec) / 1000000.0;
+        int64_t elapsed_ns = (int64_t) (current_time.tv_sec - last_time.tv_sec) * 1000000000LL +
+                             (current_time.tv_nsec - last_time.tv_nsec);
         last_time = current_time;
-        if (sample_count < MAX_SAMPLES) {
-            periods_ms[sample_count++] = elapsed_ms;
+        if (!first_job) {
+            histogram_record(&periods_ns, elapsed_ns > 0 ? (uint64_t) elapsed_ns : 0);
+            deviation_record(&jitter_ns, elapsed_ns - timer.period_ns);
         }
+        first_job = 0;
 
         pthread_mutex_lock(&g_robot_mutex);
         update_input(g_robot_state, simulation_time);
@@ -143,16 +167,16 @@ void* thread_controle_io(void* filename_arg) {
 
         pthread_mutex_unlock(&g_robot_mutex);
 
-        fprintf(out_file, "%lf %lf %lf %lf %lf %lf %lf %lf\n",
-                simulation_time, v, w, xc, yc, theta, xf, yf);
+        // Só enfileira: o disco fica com a thread escritora.
+        const double values[] = { simulation_time, v, w, xc, yc, theta, xf, yf };
+        async_log_push(g_log_stream, values, sizeof(values) / sizeof(values[0]));
 
         simulation_time += dt;
-        usleep(30000);
     }
     
-    fclose(out_file);
-    printf("Thread de Controle/IO finalizada. Dados salvos em %s\n", output_filename);
-    calculate_and_print_stats(&periods_ms[1], sample_count - 1, 30.0);
+    printf("Thread de Controle/IO finalizada.\n");
+    calculate_and_print_stats(&periods_ns, &jitter_ns, 30.0);
+    periodic_print_latency_stats("Thread de Controle/IO (30ms)", &timer);
     
     return NULL;
 }
@@ -164,63 +188,46 @@ void* thread_simulacao(void* arg) {
     (void)arg;
     printf("Thread de Simulação (50ms) iniciada.\n");
     const double dt = 0.050;
+    PeriodicTask timer;
+    periodic_init(&timer, dt);
 
     while (g_simulation_running) {
+        periodic_wait_next(&timer);
         pthread_mutex_lock(&g_robot_mutex);
         update_state(g_robot_state, dt);
         pthread_mutex_unlock(&g_robot_mutex); // Corrigido de g_mutex para g_robot_mutex
-        usleep(50000);
     }
 
     printf("Thread de Simulação finalizada.\n");
+    periodic_print_latency_stats("Thread de Simulação (50ms)", &timer);
     return NULL;
 }
 
 /**
- * @brief Função para calcular e imprimir as estatísticas de tempo.
+ * @brief Função para calcular e imprimir as estatísticas de tempo: média e
+ * variância exatas (Welford); percentis do jitter, com T(k) = nominal + J(k).
  */
-void calculate_and_print_stats(double periods[], int count, double nominal_period_ms) {
-    if (count <= 0) return;
-
-    double sum_t = 0, sum_j = 0;
-    double min_t = periods[0], max_t = periods[0];
-    double jitters[count];
-
-    for (int i = 0; i < count; i++) {
-        double p = periods[i];
-        sum_t += p;
-        if (p < min_t) min_t = p;
-        if (p > max_t) max_t = p;
-        jitters[i] = p - nominal_period_ms;
-    }
-    double mean_t = sum_t / count;
-
-    double min_j = jitters[0], max_j = jitters[0];
-    for (int i = 0; i < count; i++) {
-        sum_j += jitters[i];
-        if (jitters[i] < min_j) min_j = jitters[i];
-        if (jitters[i] > max_j) max_j = jitters[i];
-    }
-    double mean_j = sum_j / count;
-
-    double variance_t = 0, variance_j = 0;
-    for (int i = 0; i < count; i++) {
-        variance_t += pow(periods[i] - mean_t, 2);
-        variance_j += pow(jitters[i] - mean_j, 2);
-    }
-    variance_t /= count;
-    variance_j /= count;
-
+void calculate_and_print_stats(const Histogram* periods_ns, const DeviationHistogram* jitter_ns,
+                               double nominal_period_ms) {
+    if (periods_ns->count == 0) return;
+    static const struct { const char* name; double p; } rows[] = {
+        { "Mínimo", 0.0 }, { "p50", 50.0 }, { "p90", 90.0 }, { "p99", 99.0 }, { "p99.9", 99.9 }, { "Máximo", 100.0 },
+    };
+    double mean_t = periods_ns->mean / 1e6;
+    double variance_t = histogram_variance(periods_ns) / 1e12;
     double std_dev_t = sqrt(variance_t);
-    double std_dev_j = sqrt(variance_j);
 
     printf("\n--- Análise de Tempo da Tarefa de 30ms ---\n");
     printf("| Métrica      | Período T(k) [ms] | Jitter J(k) [ms]  |\n");
     printf("|--------------|-------------------|-------------------|\n");
-    printf("| Média        | %17.6f | %17.6f |\n", mean_t, mean_j);
-    printf("| Variância    | %17.6f | %17.6f |\n", variance_t, variance_j);
-    printf("| Desvio Padrão| %17.6f | %17.6f |\n", std_dev_t, std_dev_j);
-    printf("| Mínimo       | %17.6f | %17.6f |\n", min_t, min_j);
-    printf("| Máximo       | %17.6f | %17.6f |\n", max_t, max_j);
+    printf("| Amostras     | %17lu | %17lu |\n", (unsigned long) periods_ns->count, (unsigned long) periods_ns->count);
+    printf("| Média        | %17.6f | %17.6f |\n", mean_t, mean_t - nominal_period_ms);
+    printf("| Variância    | %17.6f | %17.6f |\n", variance_t, variance_t);
+    printf("| Desvio Padrão| %17.6f | %17.6f |\n", std_dev_t, std_dev_t);
+    for (size_t i = 0; i < sizeof(rows) / sizeof(rows[0]); i++) {
+        double jitter_ms = deviation_percentile(jitter_ns, rows[i].p) / 1e6;
+        printf("| %-*s | %17.6f | %17.6f |\n", text_field_width(rows[i].name, 12), rows[i].name,
+               nominal_period_ms + jitter_ms, jitter_ms);
+    }
     printf("------------------------------------------------------\n");
 }
\ No newline at end of file
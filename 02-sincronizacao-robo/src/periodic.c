@@ -0,0 +1,56 @@
+#define _DEFAULT_SOURCE // Habilita clock_nanosleep
+
+#include <stdio.h>
+#include <errno.h>
+#include "periodic.h"
+
+#define NSEC_PER_SEC 1000000000L
+
+// Soma nanossegundos a um instante, mantendo tv_nsec normalizado.
+static void timespec_add_ns(struct timespec* ts, long ns) {
+    ts->tv_nsec += ns;
+    while (ts->tv_nsec >= NSEC_PER_SEC) {
+        ts->tv_nsec -= NSEC_PER_SEC;
+        ts->tv_sec++;
+    }
+}
+
+// Diferença (a - b) em nanossegundos, sem passar por ponto flutuante.
+static int64_t timespec_diff_ns(const struct timespec* a, const struct timespec* b) {
+    return (int64_t) (a->tv_sec - b->tv_sec) * NSEC_PER_SEC + (a->tv_nsec - b->tv_nsec);
+}
+
+// Implementação da inicialização.
+void periodic_init(PeriodicTask* task, double period_s) {
+    task->period_ns = (long) (period_s * NSEC_PER_SEC + 0.5);
+    task->jobs = 0;
+    histogram_init(&task->latency_ns);
+    clock_gettime(CLOCK_MONOTONIC, &task->next_release);
+    task->last_release = task->next_release;
+}
+
+// Implementação da espera pela próxima liberação.
+void periodic_wait_next(PeriodicTask* task) {
+    // Dorme até o instante absoluto; reinicia se for interrompido por sinal.
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &task->next_release, NULL) == EINTR) {
+    }
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (task->jobs > 0) {
+        int64_t latency_ns = timespec_diff_ns(&start, &task->next_release);
+        histogram_record(&task->latency_ns, latency_ns > 0 ? (uint64_t) latency_ns : 0);
+    }
+
+    task->last_release = task->next_release;
+    timespec_add_ns(&task->next_release, task->period_ns);
+    task->jobs++;
+}
+
+// Implementação do relatório de latência de liberação.
+void periodic_print_latency_stats(const char* task_name, const PeriodicTask* task) {
+    if (task->latency_ns.count == 0) return;
+    printf("\n--- Latência de Liberação (liberação -> início): %s ---\n", task_name);
+    printf("  - Jobs:   %ld\n", task->jobs);
+    histogram_print_ms(&task->latency_ns, NULL);
+}
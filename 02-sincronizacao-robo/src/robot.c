@@ -1,6 +1,7 @@
 #include <math.h>
 #include <stdlib.h>
 #include "robot.h"
+#include "fastmath.h"
 
 // Implementação da criação e inicialização do estado do robô
 RobotState* create_robot_state() {
@@ -47,12 +48,14 @@ void update_state(RobotState* state, double dt) {
     double v = state->u->data[0][0];
     double omega = state->u->data[1][0];
     double theta = state->x->data[2][0];
+    double sin_theta, cos_theta;
+    fast_sincos(theta, &sin_theta, &cos_theta);
 
     // Modelo cinemático exatamente como no PDF
     // x1_ponto = v * sin(theta)
     // x2_ponto = v * cos(theta)
-    double dx1_dt = v * sin(theta);
-    double dx2_dt = v * cos(theta);
+    double dx1_dt = v * sin_theta;
+    double dx2_dt = v * cos_theta;
     double dx3_dt = omega;
 
     // Integração de Euler
@@ -73,8 +76,10 @@ void calculate_output_yf(RobotState* state) {
     double yc = state->x->data[1][0];
     double theta = state->x->data[2][0];
     double radius = ROBOT_DIAMETER / 2.0;
+    double sin_theta, cos_theta;
+    fast_sincos(theta, &sin_theta, &cos_theta);
 
-    state->y_f->data[0][0] = xc + radius * sin(theta); // Posição X frontal
-    state->y_f->data[1][0] = yc + radius * cos(theta); // Posição Y frontal
+    state->y_f->data[0][0] = xc + radius * sin_theta; // Posição X frontal
+    state->y_f->data[1][0] = yc + radius * cos_theta; // Posição Y frontal
     state->y_f->data[2][0] = theta;                    // A orientação é a mesma
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+#ifndef ANALYSIS_H
+#define ANALYSIS_H
+
+// --- Configuração ---
+// A iteração da análise de tempo de resposta desiste quando a janela passa
+// deste múltiplo do deadline (carga >= 100%: a recorrência não converge).
+#define ANALYSIS_MAX_WINDOW_FACTOR 100.0
+
+// --- Estruturas de Dados ---
+// Entrada e saída da análise de uma tarefa (tempos em ms). Os parâmetros
+// vêm das medições da própria execução: Ci máximo observado, jitter de
+// liberação máximo e o termo de bloqueio.
+typedef struct {
+    const char* name;
+    double c_ms;      // Ci: maior tempo de computação medido
+    double t_ms;      // Período
+    double d_ms;      // Deadline relativo
+    int priority;     // Prioridade fixa (maior = mais prioritária)
+    double b_ms;      // Bi: bloqueio por tarefas menos prioritárias
+    double j_ms;      // Ji: jitter de liberação (maior atraso liberação -> início)
+    int b_unbounded;  // 1 se Bi não tem limite (mutex sem herança de prioridade)
+
+    // Saídas
+    double r_ms;      // Ri: pior tempo de resposta (inclui Ji); < 0 se não converge
+    double slack_ms;  // Di - Ri (negativa = deadline pode ser perdido)
+} AnalysisTask;
+
+// Resultado dos testes para o conjunto de tarefas. Com algum Bi ilimitado os
+// vereditos ficam em -1 (sem veredito): nenhum teste com bloqueio se aplica.
+typedef struct {
+    int n_tasks;
+    double utilization;      // Soma de Ci/Ti
+    double ll_bound;         // n(2^(1/n) - 1)
+    int ll_ok;               // Liu & Layland com bloqueio, tarefa a tarefa
+    double hyperbolic;       // Maior produto do teste hiperbólico (com bloqueio)
+    int hyperbolic_ok;       // hyperbolic <= 2
+    int rta_ok;              // Ri <= Di para todas as tarefas
+    double edf_density;      // Maior carga do teste EDF com bloqueio (SRP)
+    int edf_ok;              // edf_density <= 1
+} AnalysisResult;
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Executa a análise de tempo de resposta exata (prioridade fixa, com
+ * bloqueio e jitter de liberação), os testes de Liu & Layland e hiperbólico
+ * com bloqueio e o teste de densidade EDF com bloqueio (Baker/SRP).
+ * Preenche r_ms e slack_ms de cada tarefa (Ri < 0 se Bi é ilimitado).
+ * @param tasks As tarefas (n posições).
+ * @param n Número de tarefas.
+ * @param result Resultado dos testes.
+ * @return 0 em caso de sucesso, -1 se algum parâmetro for inválido.
+ */
+int analysis_run(AnalysisTask* tasks, int n, AnalysisResult* result);
+
+/**
+ * @brief Imprime a tabela por tarefa (Ci, Ti, Di, Bi, Ji, Ri, folga) e o
+ * veredito de cada teste.
+ * @param tasks As tarefas já analisadas.
+ * @param n Número de tarefas.
+ * @param result Resultado de analysis_run().
+ */
+void analysis_print(const AnalysisTask* tasks, int n, const AnalysisResult* result);
+
+#endif // ANALYSIS_H
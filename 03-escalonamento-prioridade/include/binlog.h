@@ -0,0 +1,123 @@
+#ifndef BINLOG_H
+#define BINLOG_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// --- Formato ---
+// Arquivo = cabeçalho | registros | índice | rodapé, tudo little-endian.
+//   Cabeçalho: BinLogHeader seguido de n_columns nomes de BINLOG_NAME_LEN bytes.
+//   Registro:  n_columns doubles (coluna 0 = tempo, crescente).
+//   Índice:    um BinLogIndexEntry a cada index_stride registros.
+//   Rodapé:    BinLogFooter, gravado ao fechar. Sem ele (execução interrompida)
+//              o número de registros sai do tamanho do arquivo e não há índice.
+#define BINLOG_MAGIC "LAB3LOG"
+#define BINLOG_FOOTER_MAGIC "LAB3IDX"
+#define BINLOG_VERSION 1
+#define BINLOG_NAME_LEN 32
+#define BINLOG_TEXT_LEN 128
+#define BINLOG_MAX_COLUMNS 64
+#define BINLOG_INDEX_STRIDE 1024
+
+_Static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "O formato binário é gravado na ordem do host (little-endian)");
+
+typedef struct {
+    char magic[8];             // BINLOG_MAGIC
+    uint32_t version;          // BINLOG_VERSION
+    uint32_t n_columns;
+    uint32_t record_size;      // n_columns * sizeof(double)
+    uint32_t header_size;      // Deslocamento do primeiro registro
+    uint64_t index_stride;     // Registros entre duas entradas do índice
+    char description[BINLOG_TEXT_LEN]; // Condições da execução (ex.: "carga: nenhuma")
+} BinLogHeader;
+
+typedef struct {
+    double t;                  // Coluna 0 do registro indexado
+    uint64_t record;           // Posição do registro
+} BinLogIndexEntry;
+
+typedef struct {
+    char magic[8];             // BINLOG_FOOTER_MAGIC
+    uint64_t n_records;
+    uint64_t index_offset;     // Deslocamento do índice no arquivo
+    uint64_t n_index;          // Entradas do índice
+} BinLogFooter;
+
+// --- Estruturas de Dados ---
+// Escrita (uma única thread: a escritora do log assíncrono).
+typedef struct {
+    FILE* file;
+    int n_columns;
+    uint64_t n_records;
+    BinLogIndexEntry* index;
+    uint64_t n_index;
+    uint64_t index_capacity;
+    uint64_t index_failures;   // Entradas do índice omitidas por falta de memória
+    char filename[256];        // Para o aviso ao fechar
+} BinLog;
+
+// Leitura por mmap: abrir custa o mesmo para qualquer tamanho de arquivo.
+typedef struct {
+    const unsigned char* map;
+    size_t map_size;
+    const BinLogHeader* header;
+    const char (*columns)[BINLOG_NAME_LEN];
+    const double* records;
+    uint64_t n_records;
+    const BinLogIndexEntry* index; // NULL se o arquivo não tem rodapé
+    uint64_t n_index;
+} BinLogReader;
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Cria o arquivo e grava o cabeçalho.
+ * @param filename Caminho do arquivo.
+ * @param description Texto livre gravado no cabeçalho (truncado em BINLOG_TEXT_LEN - 1).
+ * @param columns Nomes das colunas (a primeira é o tempo).
+ * @param n_columns Número de colunas (até BINLOG_MAX_COLUMNS).
+ * @return Ponteiro para o log ou NULL em caso de falha.
+ */
+BinLog* create_binlog(const char* filename, const char* description, const char* const* columns, int n_columns);
+
+/**
+ * @brief Acrescenta um registro (uma cópia para o buffer do stdio). Se faltar
+ * memória para o índice, o registro é gravado mesmo assim e só a entrada do
+ * índice é omitida (contada em index_failures): a busca por tempo continua
+ * correta, apenas percorre um trecho maior do arquivo.
+ * @param log O log.
+ * @param values n_columns valores.
+ * @return 0 em caso de sucesso, -1 em caso de erro de escrita.
+ */
+int binlog_append(BinLog* log, const double* values);
+
+// Envia ao sistema os registros ainda no buffer.
+void binlog_flush(BinLog* log);
+
+// Grava o índice e o rodapé, fecha o arquivo e libera o log. Avisa em stderr
+// se entradas do índice foram omitidas.
+void free_binlog(BinLog* log);
+
+/**
+ * @brief Mapeia um log binário e valida o cabeçalho.
+ * @param filename Caminho do arquivo.
+ * @return Ponteiro para o leitor ou NULL (mensagem em stderr) em caso de falha.
+ */
+BinLogReader* open_binlog_reader(const char* filename);
+
+// Ponteiro para os n_columns valores do registro i (i < n_records).
+const double* binlog_record(const BinLogReader* reader, uint64_t i);
+
+/**
+ * @brief Localiza o primeiro registro com tempo >= t: busca no índice e depois
+ * entre duas entradas consecutivas (um bloco de index_stride registros, ou mais
+ * se entradas foram omitidas; o arquivo inteiro se não há índice).
+ * @return Posição do registro (n_records se nenhum).
+ */
+uint64_t binlog_seek_time(const BinLogReader* reader, double t);
+
+// Desfaz o mapeamento e libera o leitor.
+void free_binlog_reader(BinLogReader* reader);
+
+#endif // BINLOG_H
@@ -0,0 +1,43 @@
+#ifndef CYCLIC_H
+#define CYCLIC_H
+
+// --- Configuração ---
+// Maior hiperperíodo aceito para a tabela (em ms).
+#define CYCLIC_MAX_HYPERPERIOD_MS 60000
+
+// --- Estrutura de Dados ---
+// Tabela de um executivo cíclico: o hiperperíodo (quadro maior) é dividido em
+// quadros menores de mesma duração, e cada quadro lista os jobs liberados no
+// seu início, em ordem Rate Monotonic (menor período primeiro).
+typedef struct {
+    int n_tasks;
+    int minor_frame_ms;  // Duração do quadro menor
+    int hyperperiod_ms;  // Duração do quadro maior (MMC dos períodos)
+    int n_frames;        // hyperperiod_ms / minor_frame_ms
+    int* frame_offset;   // n_frames + 1 posições: jobs do quadro f em frame_tasks[frame_offset[f] .. frame_offset[f+1])
+    int* frame_tasks;    // Índices das tarefas, quadro após quadro
+} CyclicSchedule;
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Gera a tabela a partir dos períodos das tarefas. O quadro menor é o
+ * MDC dos períodos: todo job é liberado exatamente no início de um quadro e a
+ * condição clássica 2f - mdc(f, Ti) <= Di vale para D = T.
+ * @param periods_s Períodos das tarefas em segundos (múltiplos inteiros de 1 ms).
+ * @param n_tasks Número de tarefas.
+ * @return Ponteiro para a tabela ou NULL (períodos inválidos ou hiperperíodo grande demais).
+ */
+CyclicSchedule* create_cyclic_schedule(const double* periods_s, int n_tasks);
+
+// Libera a memória da tabela.
+void free_cyclic_schedule(CyclicSchedule* schedule);
+
+/**
+ * @brief Imprime o resumo e os quadros não vazios da tabela.
+ * @param schedule A tabela.
+ * @param names Nome de cada tarefa (n_tasks posições).
+ */
+void cyclic_schedule_print(const CyclicSchedule* schedule, const char* const* names);
+
+#endif // CYCLIC_H
@@ -0,0 +1,71 @@
+#ifndef DASHBOARD_H
+#define DASHBOARD_H
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+// --- Configuração ---
+#define DASHBOARD_MAX_ROWS 24
+#define DASHBOARD_COLS 96
+#define DASHBOARD_BUFFER_BYTES (DASHBOARD_MAX_ROWS * (DASHBOARD_COLS + 16) + 64)
+
+// --- Estruturas de Dados ---
+// Um quadro do painel: uma linha de texto por campo e a posição em que o
+// cursor fica ao final (onde o usuário digita).
+typedef struct {
+    char rows[DASHBOARD_MAX_ROWS][DASHBOARD_COLS];
+    int n_rows;
+    int cursor_row;
+    int cursor_col;
+} DashboardFrame;
+
+// Preenche o quadro seguinte a partir do estado da aplicação.
+typedef void (*DashboardFormatFn)(void* ctx, DashboardFrame* frame);
+
+// Painel de terminal redesenhado no lugar com sequências ANSI por uma thread
+// própria (SCHED_OTHER), fora das tarefas periódicas. A cada quadro só as
+// linhas que mudaram são reescritas, tudo num único write().
+typedef struct {
+    DashboardFormatFn format;
+    void* ctx;
+    int period_ms;
+    int enabled;               // 0 se a saída padrão não é um terminal
+    atomic_int running;
+    int started;
+    pthread_t thread;
+    DashboardFrame shown;      // Último quadro desenhado
+    int drawn;                 // 0 até o primeiro quadro (tela limpa uma vez)
+    char buffer[DASHBOARD_BUFFER_BYTES];
+
+    // Estatísticas (só a thread do painel escreve)
+    uint64_t frames;
+    uint64_t rows_written;
+    uint64_t bytes_written;
+    uint64_t max_render_ns;
+} Dashboard;
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Cria o painel (desativado se a saída padrão não for um terminal).
+ * @param format Função que monta cada quadro.
+ * @param ctx Argumento repassado a format.
+ * @param period_ms Intervalo entre quadros.
+ * @return Ponteiro para o painel ou NULL em caso de falha.
+ */
+Dashboard* create_dashboard(DashboardFormatFn format, void* ctx, int period_ms);
+
+// Inicia a thread do painel (nada a fazer se desativado). Retorna 0 ou -1.
+int dashboard_start(Dashboard* dashboard);
+
+// Para a thread e deixa o cursor abaixo do painel, para os relatórios.
+void dashboard_stop(Dashboard* dashboard);
+
+// Imprime quadros, linhas e bytes escritos e o maior custo de um quadro.
+void dashboard_print_stats(const Dashboard* dashboard);
+
+// Para o painel, se necessário, e libera a memória.
+void free_dashboard(Dashboard* dashboard);
+
+#endif // DASHBOARD_H
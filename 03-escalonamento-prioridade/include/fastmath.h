@@ -0,0 +1,43 @@
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+#include <stddef.h>
+
+// --- Configuração ---
+// Por padrão fast_sincos() usa o sincos() da libm (seno e cosseno numa única
+// chamada). Compilando com -DFASTMATH_POLY (ou 'make FASTMATH=poly') passa a
+// usar a aproximação polinomial, com erro absoluto limitado por
+// FASTMATH_POLY_MAX_ERROR dentro de |x| <= FASTMATH_POLY_MAX_ARG.
+
+// Maior argumento tratado pela redução de Cody-Waite; acima disso cai na libm.
+#define FASTMATH_POLY_MAX_ARG 8.0e5
+// Limite teórico do erro absoluto do polinômio (termo de Taylor de ordem 13 em pi/4).
+#define FASTMATH_POLY_MAX_ERROR 1.0e-11
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Calcula seno e cosseno do mesmo ângulo numa única operação.
+ * @param x Ângulo em radianos.
+ * @param s Ponteiro onde será armazenado sin(x).
+ * @param c Ponteiro onde será armazenado cos(x).
+ */
+void fast_sincos(double x, double* s, double* c);
+
+/**
+ * @brief Versão em lote de fast_sincos(): s[i] = sin(x[i]), c[i] = cos(x[i]).
+ * O laço é escrito sem desvios para permitir a vetorização pelo compilador.
+ * @param x Vetor de ângulos (n elementos).
+ * @param s Vetor de saída dos senos (n elementos).
+ * @param c Vetor de saída dos cossenos (n elementos).
+ * @param n Número de elementos.
+ */
+void fast_sincos_batch(const double* x, double* s, double* c, size_t n);
+
+// -- Implementações explícitas (usadas pelo benchmark e pelo relatório de precisão) --
+void fast_sincos_libm(double x, double* s, double* c);
+void fast_sincos_poly(double x, double* s, double* c);
+void fast_sincos_batch_libm(const double* x, double* s, double* c, size_t n);
+void fast_sincos_batch_poly(const double* restrict x, double* restrict s, double* restrict c, size_t n);
+
+#endif // FASTMATH_H
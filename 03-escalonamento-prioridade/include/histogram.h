@@ -0,0 +1,107 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <stdint.h>
+
+// --- Configuração ---
+// Histograma log-linear: cada potência de 2 é dividida em 2^HISTOGRAM_SUB_BITS
+// faixas iguais, então o erro relativo de qualquer percentil fica abaixo de
+// 1 / 2^HISTOGRAM_SUB_BITS (0,78%). Valores abaixo de 2^HISTOGRAM_SUB_BITS são exatos.
+#define HISTOGRAM_SUB_BITS 7
+#define HISTOGRAM_SUB_COUNT (1 << HISTOGRAM_SUB_BITS)
+// Maior valor representável: 2^HISTOGRAM_MAX_EXP - 1 (em ns, ~18 minutos).
+#define HISTOGRAM_MAX_EXP 40
+#define HISTOGRAM_BUCKETS ((HISTOGRAM_MAX_EXP - HISTOGRAM_SUB_BITS + 1) * HISTOGRAM_SUB_COUNT)
+
+// --- Estrutura de Dados ---
+// Tamanho fixo e sem alocação: pode ser gravado em tempo real por uma única
+// thread sem chamadas de sistema nem locks, por execuções de qualquer duração.
+// Média e variância são acumuladas à parte pelo método de Welford (exatas, sem
+// guardar as amostras); os percentis vêm das faixas.
+typedef struct {
+    uint32_t counts[HISTOGRAM_BUCKETS];
+    uint64_t count;
+    uint64_t sum;
+    uint64_t min;
+    uint64_t max;
+    double mean; // Média corrente (Welford)
+    double m2;   // Soma dos quadrados dos desvios da média (Welford)
+} Histogram;
+
+// Desvio com sinal em torno de um valor nominal (ex.: jitter J(k) = T(k) - T):
+// as magnitudes de cada lado vão para um histograma próprio, então o erro dos
+// percentis é relativo ao desvio, não ao valor nominal (0,78% de 1 ms de
+// jitter, em vez de 0,78% de um período de 30 ms).
+typedef struct {
+    Histogram below; // Magnitudes dos desvios negativos
+    Histogram above; // Desvios >= 0
+} DeviationHistogram;
+
+// --- Protótipos das Funções ---
+
+// Zera o histograma.
+void histogram_init(Histogram* hist);
+
+/**
+ * @brief Registra um valor (tipicamente uma duração em ns). Custo O(1).
+ * @param hist O histograma.
+ * @param value O valor; acima do máximo representável é saturado.
+ */
+void histogram_record(Histogram* hist, uint64_t value);
+
+/**
+ * @brief Estima o percentil p a partir das faixas (limite superior da faixa).
+ * @param hist O histograma.
+ * @param p O percentil em [0, 100].
+ * @return O valor estimado, ou 0 se o histograma estiver vazio.
+ */
+uint64_t histogram_percentile(const Histogram* hist, double p);
+
+// Valor de posição 'rank' (0 = menor) em ordem crescente; exato nos extremos.
+uint64_t histogram_value_at_rank(const Histogram* hist, uint64_t rank);
+
+// Média exata dos valores registrados (0 se vazio).
+double histogram_mean(const Histogram* hist);
+
+// Variância populacional exata (m2 / count; 0 se vazio).
+double histogram_variance(const Histogram* hist);
+
+// Desvio padrão populacional exato.
+double histogram_stddev(const Histogram* hist);
+
+// Menor e maior valor que caem na faixa 'index' (0 <= index < HISTOGRAM_BUCKETS).
+uint64_t histogram_bucket_lower(int index);
+uint64_t histogram_bucket_upper(int index);
+
+// Acumula src em dst (para agregar histogramas de threads diferentes).
+void histogram_merge(Histogram* dst, const Histogram* src);
+
+/**
+ * @brief Imprime mínimo, média (com desvio padrão), p50/p90/p99/p99.9 e máximo
+ * de um histograma de durações em ns, em ms, uma métrica por linha.
+ * @param hist O histograma.
+ * @param max_note Texto após o máximo (ex.: "Este é o seu 'Ci' estimado") ou NULL.
+ */
+void histogram_print_ms(const Histogram* hist, const char* max_note);
+
+// Zera o histograma de desvios.
+void deviation_init(DeviationHistogram* dev);
+
+// Registra um desvio com sinal (tipicamente em ns). Custo O(1).
+void deviation_record(DeviationHistogram* dev, int64_t deviation);
+
+/**
+ * @brief Estima o percentil p do desvio com sinal (p = 0 e p = 100 são exatos).
+ * @param dev O histograma de desvios.
+ * @param p O percentil em [0, 100].
+ * @return O desvio estimado, ou 0 se vazio.
+ */
+int64_t deviation_percentile(const DeviationHistogram* dev, double p);
+
+// Média exata do desvio com sinal (Welford dos dois lados; 0 se vazio).
+double deviation_mean(const DeviationHistogram* dev);
+
+// Desvio padrão populacional exato do desvio com sinal (0 se vazio).
+double deviation_stddev(const DeviationHistogram* dev);
+
+#endif // HISTOGRAM_H
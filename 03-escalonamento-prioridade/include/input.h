@@ -0,0 +1,51 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <stdatomic.h>
+#include <pthread.h>
+
+// --- Configuração ---
+#define INPUT_LINE_MAX 128
+#define INPUT_POLL_MS 100 // Intervalo máximo até a thread perceber o pedido de parada
+
+// --- Estruturas de Dados ---
+// Trata uma linha completa (sem o '\n'), na thread de entrada.
+typedef void (*InputLineFn)(void* ctx, const char* line);
+
+// Leitor da entrada padrão numa thread própria (SCHED_OTHER): espera linhas com
+// poll(), monta cada linha e chama o tratador. Nenhuma tarefa periódica lê o
+// teclado nem espera por ele.
+typedef struct {
+    InputLineFn handler;
+    void* ctx;
+    atomic_int running;
+    int started;
+    pthread_t thread;
+    char line[INPUT_LINE_MAX];
+    int length;
+    int overflow;            // 1 se a linha corrente passou de INPUT_LINE_MAX
+    long lines;              // Linhas entregues ao tratador
+    long truncated;          // Linhas maiores que INPUT_LINE_MAX (cortadas)
+    int eof;                 // 1 quando a entrada terminou
+} InputReader;
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Cria o leitor (sem iniciar a thread).
+ * @param handler Função chamada para cada linha.
+ * @param ctx Argumento repassado ao tratador.
+ * @return Ponteiro para o leitor ou NULL em caso de falha.
+ */
+InputReader* create_input_reader(InputLineFn handler, void* ctx);
+
+// Inicia a thread de entrada. Retorna 0 ou -1 em caso de falha.
+int input_reader_start(InputReader* reader);
+
+// Para a thread (em até INPUT_POLL_MS).
+void input_reader_stop(InputReader* reader);
+
+// Para o leitor, se necessário, e libera a memória.
+void free_input_reader(InputReader* reader);
+
+#endif // INPUT_H
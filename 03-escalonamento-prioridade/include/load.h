@@ -0,0 +1,107 @@
+#ifndef LOAD_H
+#define LOAD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+
+// --- Configuração ---
+#define LOAD_DEFAULT_WINDOW_MS 100 // Janela do ciclo de trabalho
+#define LOAD_DEFAULT_MIB 64        // Conjunto de trabalho padrão dos perfis de memória e disco
+#define LOAD_MAX_THREADS 64
+
+// --- Estruturas de Dados ---
+// Recurso disputado pela carga de interferência.
+typedef enum {
+    LOAD_CPU,        // Laço de ponto flutuante em N núcleos (ULA/FPU)
+    LOAD_MEMORY,     // Cópia contínua entre buffers grandes (largura de banda da memória)
+    LOAD_CACHE,      // Acessos aleatórios a linhas de um conjunto do tamanho da última cache
+    LOAD_PAGEFAULT,  // mmap, toque em cada página e munmap (tempestade de faltas de página)
+    LOAD_SYSCALL,    // Chamadas de sistema curtas em sequência (entrada/saída do kernel)
+    LOAD_DISK,       // Escrita sequencial com fdatasync num arquivo temporário (E/S de disco)
+    NUM_LOAD_PROFILES
+} LoadProfile;
+
+// Perfil escolhido na linha de comando: "perfil[:threads[:ciclo[:MiB]]]".
+typedef struct {
+    LoadProfile profile;
+    int threads;       // Intensidade: número de threads de carga (uma por núcleo, em rodízio)
+    double duty;       // Fração ativa de cada janela, em (0, 1]
+    int window_ms;     // Duração da janela do ciclo de trabalho
+    size_t bytes;      // Conjunto de trabalho por thread (0 = padrão do perfil)
+    const char* dir;   // Diretório do arquivo temporário do perfil de disco
+} LoadConfig;
+
+// Estado de uma thread de carga (escrito só por ela até o join).
+typedef struct {
+    int index;
+    const LoadConfig* config;
+    volatile int* running;
+    volatile int* paused;
+    unsigned char* buffer;   // Buffers dos perfis de memória e cache
+    size_t bytes;
+    int fd;                  // Arquivo do perfil de disco (-1 nos demais)
+    uint64_t operations;     // Unidades de trabalho concluídas (ver load_print_summary)
+    uint64_t errors;         // Escritas que falharam no perfil de disco (não entram em operations)
+    uint64_t active_ns;      // Tempo gasto na fase ativa do ciclo
+} LoadWorker;
+
+// Gerador de carga: as threads começam ao ser criado e param em load_stop().
+typedef struct {
+    LoadConfig config;
+    volatile int running;
+    volatile int paused;     // Threads vivas, mas sem trabalhar (comando "carga off")
+    int n_workers;
+    pthread_t* tids;
+    LoadWorker* workers;
+    struct timespec started;
+    double elapsed_s;        // Duração da carga (preenchida por load_stop)
+} LoadGenerator;
+
+// --- Protótipos das Funções ---
+
+// Configuração equivalente à antiga thread de carga: cpu, 1 thread, 100% do tempo.
+void load_config_default(LoadConfig* config);
+
+/**
+ * @brief Lê um perfil no formato "perfil[:threads[:ciclo[:MiB]]]", ex.:
+ * "memoria:2:0.5:128". Perfis: cpu, memoria, cache, paginas, syscall, disco.
+ * Campos omitidos mantêm o valor atual de config.
+ * @param spec O texto da linha de comando.
+ * @param config A configuração a preencher.
+ * @return 0 em caso de sucesso, -1 se o texto for inválido.
+ */
+int load_config_parse(const char* spec, LoadConfig* config);
+
+// Nome do perfil usado na linha de comando e nos relatórios.
+const char* load_profile_name(LoadProfile profile);
+
+/**
+ * @brief Descreve a configuração numa linha (gravada no cabeçalho do log).
+ * @param config A configuração.
+ * @param buffer Destino do texto.
+ * @param size Tamanho do destino.
+ */
+void load_config_describe(const LoadConfig* config, char* buffer, size_t size);
+
+/**
+ * @brief Aloca os recursos de cada thread e inicia a carga (SCHED_OTHER).
+ * @param config A configuração (copiada).
+ * @return Ponteiro para o gerador ou NULL em caso de falha.
+ */
+LoadGenerator* create_load_generator(const LoadConfig* config);
+
+// Suspende (paused = 1) ou retoma a carga sem encerrar as threads; vale a partir da janela seguinte.
+void load_set_paused(LoadGenerator* gen, int paused);
+
+// Sinaliza o fim e aguarda as threads de carga (pode ser chamada mais de uma vez).
+void load_stop(LoadGenerator* gen);
+
+// Imprime, após load_stop(), o trabalho realizado e a fração ativa medida.
+void load_print_summary(const LoadGenerator* gen);
+
+// Para a carga, se necessário, e libera os recursos.
+void free_load_generator(LoadGenerator* gen);
+
+#endif // LOAD_H
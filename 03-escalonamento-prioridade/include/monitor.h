@@ -0,0 +1,94 @@
+#ifndef MONITOR_H
+#define MONITOR_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "histogram.h"
+
+// --- Configuração ---
+#define MONITOR_MAX_TASKS 8    // Tarefas que podem se registrar (índice = id da tarefa)
+#define MONITOR_MAX_MUTEXES 8  // Mutexes instrumentados
+
+// --- Estruturas de Dados ---
+// Mutex de um "monitor" com identificação para as estatísticas de bloqueio.
+typedef struct {
+    pthread_mutex_t mutex;
+    const char* name;
+    int id;
+    int priority_inherit; // 1 se o mutex usa PTHREAD_PRIO_INHERIT (bloqueio limitado)
+} MonitorMutex;
+
+// Estatísticas de um par (tarefa, mutex). Cada linha da tabela é escrita apenas
+// pela própria tarefa, então a coleta dispensa sincronização; a leitura é feita
+// depois do join das threads.
+typedef struct {
+    uint64_t acquisitions;   // Número de lock()
+    uint64_t contended;      // lock() que encontraram o mutex ocupado
+    uint64_t acquired_at_ns; // Instante da aquisição corrente (para o tempo de posse)
+    Histogram wait_ns;       // Espera pela aquisição (o termo de bloqueio)
+    Histogram hold_ns;       // Tempo com o mutex em posse
+} MonitorLockStats;
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Inicializa um mutex instrumentado, com herança de prioridade
+ * (PTHREAD_PRIO_INHERIT). Se o protocolo não for suportado, segue com um mutex
+ * comum e avisa; priority_inherit fica 0.
+ * @param m O mutex.
+ * @param name Nome exibido no relatório (ex: "g_robot_mutex").
+ * @return 0 em caso de sucesso, -1 se exceder MONITOR_MAX_MUTEXES.
+ */
+int monitor_init(MonitorMutex* m, const char* name);
+
+// Destrói o mutex.
+void monitor_destroy(MonitorMutex* m);
+
+/**
+ * @brief Associa a thread chamadora a uma tarefa; os lock() seguintes dela são
+ * contabilizados nessa linha. Threads não registradas usam o mutex sem medição.
+ * @param task_id Índice da tarefa (< MONITOR_MAX_TASKS).
+ * @param task_name Nome exibido no relatório.
+ */
+void monitor_register_task(int task_id, const char* task_name);
+
+// Adquire o mutex medindo a espera (tenta sem bloquear antes de medir).
+void monitor_lock(MonitorMutex* m);
+
+// Libera o mutex registrando o tempo de posse.
+void monitor_unlock(MonitorMutex* m);
+
+/**
+ * @brief Fecha o job corrente da tarefa chamadora: a espera acumulada em todos
+ * os mutexes durante o job vira uma amostra do bloqueio por job (B_i).
+ */
+void monitor_job_done(void);
+
+/**
+ * @brief Imprime o bloqueio por job de uma tarefa (média, p99, máximo = B_i observado).
+ * @param task_id Índice da tarefa.
+ * @param label Rótulo do cabeçalho (mesmo de print_computation_stats).
+ */
+void monitor_print_task_blocking(int task_id, const char* label);
+
+// Maior bloqueio por job observado de uma tarefa (B_i), em ns.
+uint64_t monitor_task_blocking_max_ns(int task_id);
+
+// Distribuição do bloqueio por job de uma tarefa, em ns (vazia se o índice for inválido).
+const Histogram* monitor_task_blocking(int task_id);
+
+// Maior tempo de posse de um mutex por uma tarefa, em ns (0 se nunca adquiriu).
+uint64_t monitor_hold_max_ns(int task_id, const MonitorMutex* m);
+
+// Imprime a tabela (tarefa x mutex) com aquisições, contenções, espera e posse.
+void monitor_print_stats(void);
+
+/**
+ * @brief Exporta a tabela (tarefa x mutex) e o B_i de cada tarefa em CSV.
+ * @param filename Caminho do arquivo.
+ * @return 0 em caso de sucesso, -1 se o arquivo não puder ser criado.
+ */
+int monitor_export_csv(const char* filename);
+
+#endif // MONITOR_H
@@ -0,0 +1,88 @@
+#ifndef PERIODIC_H
+#define PERIODIC_H
+
+#include <time.h>
+#include "histogram.h"
+
+// --- Estrutura de Dados ---
+// Liberação periódica com instantes absolutos em CLOCK_MONOTONIC: o próximo
+// instante é sempre o anterior + período, então o tempo de computação e a
+// latência de despertar não se acumulam como deriva.
+typedef struct {
+    long period_ns;                  // Período nominal em nanossegundos
+    long job_period_ns;              // Período que agendou a liberação do job corrente (após uma troca de
+                                     // period_ns, o primeiro job ainda foi agendado com o período anterior)
+    long next_period_ns;             // Período que agendou next_release
+    long deadline_ns;                // Deadline relativo (padrão: D = T)
+    struct timespec next_release;    // Próximo instante de liberação (absoluto)
+    struct timespec last_release;    // Instante de liberação do job corrente
+    long jobs;                       // Número de jobs liberados
+    long deadline_misses;            // Jobs que terminaram após liberação + deadline
+    double max_lateness_ms;          // Pior atraso em relação ao deadline
+    Histogram latency_ns;            // Latência liberação -> início (sem o primeiro job, de aquecimento)
+} PeriodicTask;
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Inicializa a tarefa periódica; a primeira liberação é o instante atual.
+ * @param task A estrutura da tarefa.
+ * @param period_s O período nominal em segundos.
+ */
+void periodic_init(PeriodicTask* task, double period_s);
+
+/**
+ * @brief Inicializa a tarefa periódica com um instante de primeira liberação
+ * dado (para alinhar várias tarefas a uma mesma origem).
+ * @param task A estrutura da tarefa.
+ * @param period_s O período nominal em segundos.
+ * @param first_release Instante absoluto (CLOCK_MONOTONIC) da primeira liberação.
+ */
+void periodic_init_at(PeriodicTask* task, double period_s, const struct timespec* first_release);
+
+/**
+ * @brief Dorme até a próxima liberação (clock_nanosleep com TIMER_ABSTIME),
+ * registra a latência entre a liberação e o início do job e agenda a seguinte.
+ * @param task A estrutura da tarefa.
+ */
+void periodic_wait_next(PeriodicTask* task);
+
+/**
+ * @brief Inicia o job liberado em next_release sem dormir: registra a latência
+ * liberação -> início e agenda a liberação seguinte. Usada quando outro
+ * mecanismo (ex.: o quadro do executivo cíclico) já fez a espera.
+ * @param task A estrutura da tarefa.
+ */
+void periodic_start_job(PeriodicTask* task);
+
+/**
+ * @brief Como periodic_start_job(), mas para um job liberado por evento no
+ * instante dado (tarefa disparada por outra): a latência é medida a partir dele.
+ * @param task A estrutura da tarefa.
+ * @param release Instante absoluto da liberação (ex.: fim do job produtor).
+ */
+void periodic_start_job_at(PeriodicTask* task, const struct timespec* release);
+
+/**
+ * @brief Define um deadline relativo diferente do período (D <= T).
+ * @param task A estrutura da tarefa.
+ * @param deadline_s O deadline relativo em segundos.
+ */
+void periodic_set_deadline(PeriodicTask* task, double deadline_s);
+
+/**
+ * @brief Marca o fim do job corrente e verifica o deadline (liberação + D).
+ * @param task A estrutura da tarefa.
+ * @return Atraso em ms em relação ao deadline (> 0 indica perda).
+ */
+double periodic_job_done(PeriodicTask* task);
+
+/**
+ * @brief Imprime a distribuição da latência liberação -> início (percentis) e
+ * as perdas de deadline.
+ * @param task_name Nome da tarefa para o cabeçalho.
+ * @param task A estrutura da tarefa.
+ */
+void periodic_print_latency_stats(const char* task_name, const PeriodicTask* task);
+
+#endif // PERIODIC_H
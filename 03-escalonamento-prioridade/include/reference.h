@@ -8,6 +8,44 @@ typedef struct {
     Matrix* ref_xy; // Matriz 2x1
 } ReferenceTrajectory;
 
+// Amostra completa da referência: posição, velocidade e aceleração.
+typedef struct {
+    double pos[2]; // [xref, yref]
+    double vel[2]; // [dot_xref, dot_yref]
+    double acc[2]; // [ddot_xref, ddot_yref]
+} ReferenceSample;
+
+// Um intervalo da tabela: posição, velocidade e aceleração nas duas extremidades.
+// Guardar as duas pontas por intervalo preserva a quina de yref em t = 10 s.
+typedef struct {
+    double p0[2], p1[2];
+    double v0[2], v1[2];
+    double a0[2], a1[2];
+} ReferenceSegment;
+
+// Tabela pré-calculada da trajetória, consultada em O(1) por interpolação cúbica.
+typedef struct {
+    double step;        // Passo entre os nós (s)
+    double inv_step;    // 1 / step
+    double horizon;     // Fim do trecho tabelado (s)
+    int n_segments;
+    ReferenceSegment* segments;
+} ReferenceTable;
+
+// Fonte genérica de referência: qualquer gerador que responda amostras no tempo t
+// (tabela da trajetória padrão, spline de waypoints, ...).
+typedef void (*ReferenceSampleFn)(const void* source, double t, ReferenceSample* out);
+
+typedef struct {
+    ReferenceSampleFn sample; // Função de amostragem
+    const void* source;       // Dados da fonte (tabela, spline, ...)
+    const char* name;         // Descrição para logs e relatórios
+} ReferenceSource;
+
+// Passo e horizonte padrão da tabela (t = 10 s precisa cair num nó).
+#define REFERENCE_TABLE_STEP 0.010
+#define REFERENCE_TABLE_HORIZON 20.0
+
 // --- Protótipos das Funções ---
 
 // Aloca memória para a estrutura da trajetória de referência.
@@ -23,4 +61,44 @@ void free_reference_trajectory(ReferenceTrajectory* ref);
  */
 void calculate_reference(ReferenceTrajectory* ref, double t);
 
+/**
+ * @brief Pré-calcula a trajetória e suas duas derivadas em [0, horizon].
+ * Para t além do horizonte a referência é periódica (período de 10 s após t = 10 s),
+ * então a consulta reaproveita o último período tabelado.
+ * @param step Passo entre os nós em segundos (10.0 deve ser múltiplo dele).
+ * @param horizon Fim do trecho tabelado em segundos (>= 20 s).
+ * @return Ponteiro para a tabela ou NULL em caso de falha.
+ */
+ReferenceTable* create_reference_table(double step, double horizon);
+
+// Libera a memória da tabela.
+void free_reference_table(ReferenceTable* table);
+
+/**
+ * @brief Consulta a tabela em tempo constante (interpolação cúbica de Hermite).
+ * @param table A tabela pré-calculada.
+ * @param t O tempo da simulação em segundos.
+ * @param out Amostra de saída com posição, velocidade e aceleração.
+ */
+void reference_table_lookup(const ReferenceTable* table, double t, ReferenceSample* out);
+
+/**
+ * @brief Preenche uma ReferenceTrajectory com a posição tabelada no tempo t.
+ * @param table A tabela pré-calculada.
+ * @param ref A estrutura de referência a ser preenchida.
+ * @param t O tempo da simulação em segundos.
+ */
+void reference_table_fill(const ReferenceTable* table, ReferenceTrajectory* ref, double t);
+
+// Adapta a tabela pré-calculada à interface ReferenceSource.
+ReferenceSource reference_source_from_table(const ReferenceTable* table);
+
+/**
+ * @brief Preenche uma ReferenceTrajectory com a posição dada por uma fonte no tempo t.
+ * @param src A fonte de referência.
+ * @param ref A estrutura de referência a ser preenchida.
+ * @param t O tempo da simulação em segundos.
+ */
+void reference_source_fill(const ReferenceSource* src, ReferenceTrajectory* ref, double t);
+
 #endif // REFERENCE_H
\ No newline at end of file
@@ -0,0 +1,54 @@
+#ifndef REPORT_H
+#define REPORT_H
+
+#include <time.h>
+#include "task.h"
+
+// --- Configuração ---
+#define REPORT_FORMAT_VERSION 2 // Incrementada quando campos mudam de nome ou de unidade
+
+// --- Estrutura de Dados ---
+// Condições da execução registradas no relatório, ao lado das métricas.
+typedef struct {
+    time_t started;          // Início da simulação (hora do sistema), identifica a execução
+    double duration_s;       // Duração planejada
+    const char* log_filename;
+    const char* policy;      // Política de escalonamento efetiva (ex.: "SCHED_FIFO/RM")
+    const char* mode;        // "monitores", "canais seqlock" ou "executivo cíclico"
+    int lockfree;
+    int chained;
+    const char* load;        // Descrição da carga ("nenhuma" sem carga)
+    const char* overrun;     // Política de estouro forçada ou "por tarefa"
+    const char* trajectory;  // Arquivo de waypoints ou "tabela"
+} ReportRun;
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Exporta as métricas de tempo de todas as tarefas, a configuração da
+ * execução e a identificação da máquina (kernel, CPU) em <base>_relatorio.json
+ * e <base>_relatorio.csv (uma linha por tarefa), para comparar execuções sem
+ * interpretar a saída do terminal. Chamar depois do fim das threads.
+ * @param base Caminho dos arquivos sem extensão (o do log, sem ".bin").
+ * @param run A configuração da execução.
+ * @param rts Os estados de execução das tarefas.
+ * @param priorities Prioridade RM de cada tarefa.
+ * @param n Número de tarefas.
+ * @return 0 em caso de sucesso, -1 se algum arquivo não puder ser criado.
+ */
+int report_export(const char* base, const ReportRun* run, const TaskRuntime* rts, const int* priorities, int n);
+
+/**
+ * @brief Imprime o jitter desta execução ao lado do de uma execução anterior,
+ * lido de <baseline>_relatorio.csv (ex.: a execução padrão, ao fim de uma
+ * execução --rt com as mesmas opções): p50, p99 e |J| máximo por tarefa.
+ * @param baseline Caminho do relatório anterior sem "_relatorio.csv".
+ * @param label Rótulo das colunas desta execução (ex.: "RT").
+ * @param rts Os estados de execução das tarefas.
+ * @param n Número de tarefas.
+ * @return 0 em caso de sucesso, -1 se o relatório anterior não existe ou não
+ * tem as colunas de jitter.
+ */
+int report_print_jitter_comparison(const char* baseline, const char* label, const TaskRuntime* rts, int n);
+
+#endif // REPORT_H
@@ -0,0 +1,103 @@
+#ifndef SCHED_POLICY_H
+#define SCHED_POLICY_H
+
+#include <pthread.h>
+
+// --- Constantes ---
+// Prioridade SCHED_FIFO da tarefa de menor período; as demais descem a partir dela.
+// Fica abaixo de 99 para não competir com as threads de tempo real do kernel.
+#define RM_PRIORITY_TOP 80
+// Modo EDF: jobs medidos em SCHED_OTHER antes de pedir SCHED_DEADLINE.
+#define EDF_WARMUP_JOBS 20
+// Margem aplicada ao Ci medido para obter o runtime reservado.
+#define EDF_RUNTIME_MARGIN 2.0
+// Runtime mínimo reservado (s): abaixo disso a contabilização do kernel é grosseira demais.
+#define EDF_MIN_RUNTIME_S 0.0002
+// Tamanho explícito da pilha das tarefas de tempo real (pré-falhada e travada).
+#define RT_STACK_SIZE (256 * 1024)
+// Quanto da pilha é tocado no início da thread para evitar faltas de página depois.
+#define RT_STACK_PREFAULT (64 * 1024)
+
+// --- Estruturas de Dados ---
+// Uma entrada do conjunto de tarefas para a atribuição Rate Monotonic.
+typedef struct {
+    const char* name;
+    double period_s;
+    int priority; // Preenchida por rm_assign_priorities()
+} RmTask;
+
+// Política efetivamente aplicada a uma thread.
+typedef enum {
+    SCHED_APPLIED_DEFAULT = 0, // SCHED_OTHER herdado (modo padrão)
+    SCHED_APPLIED_FIFO,        // SCHED_FIFO com a prioridade pedida
+    SCHED_APPLIED_FALLBACK,    // SCHED_FIFO pedido, mas sem privilégio: melhor esforço
+    SCHED_APPLIED_DEADLINE,    // SCHED_DEADLINE (EDF) com runtime derivado do Ci medido
+    SCHED_APPLIED_EDF_FALLBACK // SCHED_DEADLINE recusado: continua em SCHED_OTHER
+} SchedApplied;
+
+// Estado de uma tarefa no modo EDF: mede o Ci nos primeiros jobs e então
+// migra a própria thread para SCHED_DEADLINE (runtime, deadline, período).
+typedef struct {
+    const char* name;
+    double period_s;
+    double deadline_s;
+    int observed_jobs;   // Jobs medidos até agora no aquecimento
+    double max_ci_s;     // Maior Ci observado no aquecimento
+    double runtime_s;    // Runtime reservado (0 enquanto não aplicado)
+    int applied;         // SCHED_APPLIED_*
+} EdfTask;
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Atribui prioridades Rate Monotonic: menor período, maior prioridade.
+ * Tarefas com o mesmo período recebem a mesma prioridade.
+ * @param tasks O conjunto de tarefas (campo priority é preenchido).
+ * @param n Número de tarefas.
+ */
+void rm_assign_priorities(RmTask* tasks, int n);
+
+/**
+ * @brief Trava toda a memória do processo (mlockall) para evitar faltas de página.
+ * Sem privilégio, registra o motivo e segue sem travar.
+ * @return 1 se a memória foi travada, 0 no fallback.
+ */
+int sched_lock_memory(void);
+
+/**
+ * @brief Cria uma thread com atributos explícitos de escalonamento.
+ * Com use_fifo, pede SCHED_FIFO na prioridade dada (PTHREAD_EXPLICIT_SCHED) e
+ * pré-falha a pilha; se faltar privilégio (EPERM), cria com os atributos
+ * padrão e registra o fallback. Outros erros de pthread_create não têm fallback.
+ * @param tid Identificador da thread criada.
+ * @param name Nome da tarefa (para os logs e o nome da thread, cortado em 15 bytes).
+ * @param use_fifo 1 para SCHED_FIFO, 0 para os atributos padrão.
+ * @param priority Prioridade SCHED_FIFO (ignorada sem use_fifo).
+ * @param fn Função da thread.
+ * @param arg Argumento da thread.
+ * @return A política efetivamente aplicada, ou -1 se a thread não pôde ser criada.
+ */
+int sched_create_thread(pthread_t* tid, const char* name, int use_fifo, int priority,
+                        void* (*fn)(void*), void* arg);
+
+/**
+ * @brief Inicializa o estado EDF de uma tarefa (deadline implícito D = T).
+ * @param task O estado EDF.
+ * @param name Nome da tarefa.
+ * @param period_s Período da tarefa em segundos.
+ */
+void edf_task_init(EdfTask* task, const char* name, double period_s);
+
+/**
+ * @brief Registra o Ci de um job; ao fim do aquecimento pede SCHED_DEADLINE para
+ * a thread chamadora com runtime = max(Ci) * EDF_RUNTIME_MARGIN. Sem suporte do
+ * kernel ou sem privilégio, registra o fallback e segue em SCHED_OTHER.
+ * @param task O estado EDF (da própria thread).
+ * @param ci_ms Tempo de computação do job em milissegundos.
+ */
+void edf_observe_job(EdfTask* task, double ci_ms);
+
+// Nome legível de uma política aplicada (para relatórios).
+const char* sched_applied_name(int applied);
+
+#endif // SCHED_POLICY_H
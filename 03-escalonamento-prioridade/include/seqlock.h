@@ -0,0 +1,64 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <stddef.h>
+#include <stdatomic.h>
+
+// --- Estrutura de Dados ---
+// Seqlock de escritor único com buffer duplo: o escritor nunca espera e grava
+// sempre no slot que não está publicado, depois troca o índice. Leitores copiam
+// o slot publicado e só repetem se o escritor reutilizou esse slot no meio da
+// cópia. Assim, um escritor preemptado no meio da escrita (comum com prioridades
+// SCHED_FIFO numa única CPU) nunca deixa um leitor girando: o slot publicado
+// continua íntegro.
+typedef struct {
+    atomic_uint sequence[2];    // Por slot: ímpar enquanto uma escrita está em andamento
+    atomic_uint current;        // Slot publicado mais recente
+    atomic_ulong writes;        // Publicações feitas
+    atomic_ulong read_retries;  // Cópias descartadas por colidirem com uma escrita
+} SeqLock;
+
+// --- Protótipos das Funções ---
+
+// Inicializa o seqlock (slot 0 publicado, sem escrita em andamento).
+void seqlock_init(SeqLock* lock);
+
+/**
+ * @brief Publica um novo valor (apenas uma thread pode escrever em cada seqlock).
+ * @param lock O seqlock que protege o dado.
+ * @param slots Os dois slots do dado compartilhado (array de 2 elementos).
+ * @param value O novo valor.
+ * @param size Tamanho de um slot em bytes (múltiplo de 8).
+ */
+void seqlock_write(SeqLock* lock, void* slots, const void* value, size_t size);
+
+/**
+ * @brief Copia um instantâneo consistente do dado sem bloquear o escritor.
+ * @param lock O seqlock que protege o dado.
+ * @param slots Os dois slots do dado compartilhado.
+ * @param value Destino da cópia.
+ * @param size Tamanho de um slot em bytes (múltiplo de 8).
+ */
+void seqlock_read(SeqLock* lock, const void* slots, void* value, size_t size);
+
+/**
+ * @brief Uma única tentativa de cópia, sem escrever no seqlock (nem no contador
+ * de repetições): serve a leitores com o dado mapeado só para leitura, como os
+ * de outro processo na memória compartilhada (ver telemetry.h).
+ * @param lock O seqlock que protege o dado.
+ * @param slots Os dois slots do dado compartilhado.
+ * @param value Destino da cópia.
+ * @param size Tamanho de um slot em bytes (múltiplo de 8).
+ * @return 0 se a cópia é consistente, -1 se colidiu com uma escrita (repetir).
+ */
+int seqlock_try_read(const SeqLock* lock, const void* slots, void* value, size_t size);
+
+// --- Canais ---
+// Um canal é uma struct { SeqLock lock; Tipo value[2]; }; as macros abaixo evitam
+// repetir o tamanho do dado em cada chamada.
+#define SEQLOCK_PUBLISH(channel, src) \
+    seqlock_write(&(channel)->lock, (channel)->value, (src), sizeof((channel)->value[0]))
+#define SEQLOCK_SNAPSHOT(channel, dst) \
+    seqlock_read(&(channel)->lock, (channel)->value, (dst), sizeof((channel)->value[0]))
+
+#endif // SEQLOCK_H
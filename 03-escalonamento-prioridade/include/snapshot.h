@@ -0,0 +1,66 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdint.h>
+#include "seqlock.h"
+#include "robot.h"
+#include "reference.h"
+#include "ref_model.h"
+#include "control.h"
+#include "trace.h"
+
+// --- Instantâneos ---
+// Cópias planas (sem ponteiros) dos objetos compartilhados, publicadas pelo
+// único escritor de cada um e lidas pelas demais tarefas sem bloqueio. O
+// carimbo acompanha o dado pela cadeia (ver trace.h).
+typedef struct {
+    double x[3]; // [Xc, Yc, theta]
+    double u[2]; // [v, omega] aplicados no passo
+    double y[2]; // [X_frente, Y_frente]
+    TraceStamp stamp;
+} RobotSnapshot;
+
+typedef struct {
+    double ref_xy[2];
+    TraceStamp stamp;
+} ReferenceSnapshot;
+
+typedef struct {
+    double y_m[2];
+    double dot_y_m[2];
+    TraceStamp stamp;
+} RefModelSnapshot;
+
+typedef struct {
+    double v[2]; // Saída do controlador (escrita pela tarefa de controle)
+    TraceStamp stamp;
+} ControlSnapshot;
+
+typedef struct {
+    double u[2]; // Saída da linearização (escrita pela tarefa de linearização)
+    TraceStamp stamp;
+} LinearizationSnapshot;
+
+typedef struct {
+    double alpha1;
+    double alpha2;
+    uint64_t version; // Incrementada a cada novo par de ganhos (0 = ganhos iniciais)
+} GainsSnapshot;
+
+// --- Canais ---
+// Alinhados à linha de cache para que a escrita num canal não invalide outro.
+typedef struct { _Alignas(64) SeqLock lock; RobotSnapshot value[2]; } RobotChannel;
+typedef struct { _Alignas(64) SeqLock lock; ReferenceSnapshot value[2]; } ReferenceChannel;
+typedef struct { _Alignas(64) SeqLock lock; RefModelSnapshot value[2]; } RefModelChannel;
+typedef struct { _Alignas(64) SeqLock lock; ControlSnapshot value[2]; } ControlChannel;
+typedef struct { _Alignas(64) SeqLock lock; LinearizationSnapshot value[2]; } LinearizationChannel;
+typedef struct { _Alignas(64) SeqLock lock; GainsSnapshot value[2]; } GainsChannel;
+
+// --- Conversões entre os objetos com Matrix e os instantâneos ---
+void robot_to_snapshot(const RobotState* state, RobotSnapshot* snap);
+void robot_from_snapshot(RobotState* state, const RobotSnapshot* snap);
+void reference_to_snapshot(const ReferenceTrajectory* ref, ReferenceSnapshot* snap);
+void ref_model_to_snapshot(const RefModel* model, RefModelSnapshot* snap);
+void ref_model_from_snapshot(RefModel* model, const RefModelSnapshot* snap);
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,206 @@
+#ifndef TASK_H
+#define TASK_H
+
+#include <time.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <semaphore.h>
+#include "periodic.h"
+#include "sched_policy.h"
+#include "monitor.h"
+#include "histogram.h"
+#include "telemetry.h"
+
+// --- Configuração ---
+#define TASK_MAX_LOCKS 4    // Mutexes declarados por tarefa
+#define TASK_ANY_CPU (-1)   // Sem afinidade de CPU
+#define TASK_MAX_MISSES 64  // Perdas de deadline guardadas na linha do tempo
+
+// --- Estruturas de Dados ---
+// Corpo de um job: chamado uma vez por ativação com o estado privado da tarefa.
+typedef void (*TaskBody)(void* state);
+
+// O que fazer com os jobs liberados enquanto um job atrasado (que perdeu o
+// deadline) ainda executava.
+typedef enum {
+    OVERRUN_IMMEDIATE, // Executa-os logo em seguida, recuperando o atraso (padrão)
+    OVERRUN_SKIP,      // Descarta-os: a tarefa volta na primeira liberação futura
+    OVERRUN_DEGRADE,   // Executa a versão degradada do corpo (ou descarta, se não houver)
+    NUM_OVERRUN_POLICIES
+} OverrunPolicy;
+
+// Descritor estático de uma tarefa periódica: uma linha da tabela de tarefas.
+typedef struct {
+    const char* name;
+    TaskBody body;
+    void* state;                          // Estado privado passado ao corpo (pode ser NULL)
+    double period_s;
+    double deadline_s;                    // Deadline relativo; 0 = igual ao período
+    int priority;                         // Prioridade SCHED_FIFO; 0 = Deadline Monotonic automática
+    int cpu;                              // CPU da afinidade ou TASK_ANY_CPU
+    OverrunPolicy overrun;                // Política para os jobs liberados durante um atraso
+    TaskBody degraded;                    // Corpo reduzido de OVERRUN_DEGRADE (pode ser NULL)
+    MonitorMutex* locks[TASK_MAX_LOCKS];  // Mutexes que o corpo pode adquirir (NULL no fim)
+} TaskDescriptor;
+
+// Uma perda de deadline na linha do tempo, com o efeito da política sobre os
+// jobs seguintes.
+typedef struct {
+    long job;             // Número do job atrasado (1 = primeiro)
+    double release_ms;    // Liberação do job atrasado, em ms desde a origem
+    double lateness_ms;   // Fim - deadline
+    OverrunPolicy policy; // Política em vigor
+    int affected;         // Jobs liberados durante o atraso (descartados, degradados ou recuperados)
+} DeadlineMiss;
+
+// Estado de execução de uma tarefa: temporizador, distribuições dos tempos dos
+// jobs (memória constante, qualquer duração de execução) e, no modo EDF, o
+// estado da migração para SCHED_DEADLINE. No modo encadeado a tarefa pode
+// ser liberada pelo fim do job do seu produtor em vez do temporizador.
+typedef struct TaskRuntime {
+    const TaskDescriptor* desc;
+    int id;                      // Índice na tabela (linha da instrumentação de mutexes)
+    volatile int* running;       // Laço da thread executa enquanto *running != 0
+    EdfTask* edf;                // Não NULL no modo EDF
+    TelemetryTaskChannel* telemetry; // Canal na memória compartilhada (NULL = sem telemetria)
+    PeriodicTask timer;
+    struct timespec origin;      // Primeira liberação (origem da linha do tempo)
+
+    // Distribuições em ns, sem o primeiro job (aquecimento).
+    int warmed_up;               // 1 depois do primeiro job executado
+    struct timespec last_start;  // Início do job anterior (para o período medido)
+    Histogram period_ns;         // Início -> início de jobs consecutivos (média, variância, extremos)
+    DeviationHistogram jitter_ns; // J(k) = período medido - período nominal (percentis)
+    Histogram computation_ns;    // Início -> fim (Ci)
+    Histogram response_ns;       // Liberação -> fim (Ri)
+    Histogram chain_response_ns; // Liberação da cabeça da cadeia -> fim (tarefas disparadas)
+
+    int triggered;                    // 1 se liberada por notificação do produtor
+    struct TaskRuntime* consumer;     // Tarefa notificada ao fim de cada job (ou NULL)
+    sem_t trigger;                    // Notificação pendente (no máximo uma)
+    _Atomic uint64_t trigger_ns;      // Instante da notificação (fim do job produtor)
+    _Atomic uint64_t chain_ns;        // Liberação da cabeça da cadeia correspondente
+    struct timespec chain_release;    // Liberação da cabeça referente ao job corrente
+    long lost_triggers;               // Notificações que chegaram com outra ainda pendente
+
+    OverrunPolicy overrun;            // Política efetiva (a do descritor ou a forçada na linha de comando)
+    struct timespec late_until;       // Fim do último job atrasado: liberações até aqui sofrem a política
+    long skipped_jobs;
+    long degraded_jobs;
+    long immediate_jobs;
+    DeadlineMiss misses[TASK_MAX_MISSES];
+    int miss_count;
+
+    _Atomic long requested_period_ns; // Período pedido por outra thread (0 = nenhum pedido)
+    long period_changes;              // Pedidos aplicados pela própria tarefa
+} TaskRuntime;
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Prepara o estado de execução de uma tarefa.
+ * @param rt O estado de execução.
+ * @param desc O descritor (deve viver enquanto a tarefa executar).
+ * @param id Índice da tarefa na tabela.
+ * @param running Flag de execução compartilhada.
+ * @param first_release Instante da primeira liberação (NULL = agora).
+ */
+void task_runtime_init(TaskRuntime* rt, const TaskDescriptor* desc, int id, volatile int* running,
+                       const struct timespec* first_release);
+
+// Deadline relativo efetivo da tarefa em segundos (período quando deadline_s = 0).
+double task_deadline_s(const TaskDescriptor* desc);
+
+// Período efetivo da tarefa em segundos (o da cadeia, se encadeada).
+double task_period_s(const TaskRuntime* rt);
+
+/**
+ * @brief Pede um novo período, aplicado pela própria thread da tarefa antes da
+ * liberação seguinte (o deadline acompanha quando D = T). Pode ser chamada de
+ * qualquer thread; não se aplica ao executivo cíclico, cuja tabela é fixa.
+ * @param rt O estado de execução.
+ * @param period_s O novo período em segundos.
+ * @return 0 se o pedido foi registrado, -1 se a tarefa é liberada pelo produtor
+ * (modo encadeado) ou o período é inválido.
+ */
+int task_request_period(TaskRuntime* rt, double period_s);
+
+/**
+ * @brief Executa o job já liberado (ver periodic_start_job): mede início e fim,
+ * verifica o deadline, fecha a contabilização de bloqueio e alimenta o EDF.
+ * Se o job foi liberado enquanto um job anterior estava atrasado, aplica antes
+ * a política de estouro da tarefa (descartar, executar ou degradar).
+ * @param rt O estado de execução.
+ */
+void task_run_job(TaskRuntime* rt);
+
+// Nome da política de estouro ("imediato", "descartar" ou "degradar").
+const char* overrun_policy_name(OverrunPolicy policy);
+
+/**
+ * @brief Converte o nome de uma política de estouro (ver overrun_policy_name).
+ * @param name O nome.
+ * @return A política ou -1 se o nome não for reconhecido.
+ */
+int overrun_policy_parse(const char* name);
+
+/**
+ * @brief Encadeia tarefas: o fim de cada job acorda a tarefa seguinte, e só a
+ * primeira continua com temporizador. Todas passam a ter o período da cadeia
+ * (o menor período entre elas) e deadline min(D, período da cadeia).
+ * Chamar depois de task_runtime_init() e antes de criar as threads.
+ * @param chain As tarefas na ordem produtor -> consumidor.
+ * @param n Número de tarefas (>= 2).
+ * @return O período da cadeia em segundos.
+ */
+double task_chain(TaskRuntime* const* chain, int n);
+
+// Acorda uma tarefa disparada para que ela perceba o fim da execução.
+void task_wake(TaskRuntime* rt);
+
+/**
+ * @brief Laço genérico de uma thread periódica (argumento: TaskRuntime*).
+ * Aplica a afinidade, registra a tarefa na instrumentação de mutexes e
+ * executa um job a cada liberação (temporizador ou notificação do produtor)
+ * até *running ser zerado.
+ */
+void* task_thread(void* arg);
+
+/**
+ * @brief Imprime o relatório da tarefa: período e jitter de ativação, tempo de
+ * computação, tempo de resposta, latência de liberação e bloqueio em mutexes,
+ * com percentis.
+ * @param rt O estado de execução.
+ */
+void task_print_report(const TaskRuntime* rt);
+
+// Maior tempo de computação medido (Ci), sem o primeiro job (aquecimento).
+double task_max_computation_ms(const TaskRuntime* rt);
+
+// Maior latência liberação -> início medida (jitter de liberação Ji), sem o primeiro job.
+double task_max_release_jitter_ms(const TaskRuntime* rt);
+
+/**
+ * @brief Limite do bloqueio de uma tarefa sob herança de prioridade, a partir
+ * dos conjuntos de mutexes dos descritores: soma, para cada mutex cujo teto
+ * é >= a prioridade da tarefa, da maior posse medida entre as tarefas menos
+ * prioritárias que o usam.
+ * @param rts Os estados de execução (após o fim das threads).
+ * @param priorities Prioridade de cada tarefa (maior = mais prioritária).
+ * @param n Número de tarefas.
+ * @param i Índice da tarefa analisada.
+ * @param unbounded Recebe 1 se algum desses mutexes não tem herança de
+ * prioridade: o limite não vale e Bi é ilimitado (pode ser NULL).
+ * @return O limite em ms.
+ */
+double task_blocking_bound_ms(const TaskRuntime* rts, const int* priorities, int n, int i, int* unbounded);
+
+/**
+ * @brief Imprime os contadores de perdas de deadline por tarefa e a linha do
+ * tempo das perdas de todas as tarefas, em ordem de liberação.
+ * @param rts Os estados de execução.
+ * @param n Número de tarefas.
+ */
+void task_print_miss_report(const TaskRuntime* rts, int n);
+
+#endif // TASK_H
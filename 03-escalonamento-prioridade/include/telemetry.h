@@ -0,0 +1,111 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include "seqlock.h"
+
+// --- Configuração ---
+// Segmento de memória compartilhada POSIX (/dev/shm) com o estado ao vivo da
+// simulação, para monitores em outro processo. Cada bloco é um canal seqlock
+// (seqlock.h) com um único escritor dentro da simulação; os leitores mapeiam o
+// segmento só para leitura e copiam os blocos sem chamadas de sistema e sem
+// tocar nos mutexes da simulação.
+#define TELEMETRY_DEFAULT_NAME "/lab3_telemetria"
+#define TELEMETRY_MAGIC 0x334c4d54u // "TML3"
+#define TELEMETRY_VERSION 1         // Incrementada quando o layout muda
+#define TELEMETRY_MAX_TASKS 8
+#define TELEMETRY_NAME_LEN 32
+#define TELEMETRY_TEXT_LEN 128
+
+// --- Estruturas de Dados ---
+// Blocos de tamanho múltiplo de 8 bytes (cópia palavra a palavra do seqlock).
+
+// Estado do robô, referência e ganhos, publicados pela tarefa de UI.
+typedef struct {
+    double t;              // Tempo da simulação (s)
+    double x[3];           // [Xc, Yc, theta]
+    double ref_xy[2];      // [Xref, Yref]
+    double alpha[2];       // [alpha1, alpha2] exibidos
+    uint64_t gains_version; // Versão dos ganhos publicada pelos comandos
+    uint64_t paused;       // 1 com a simulação em pausa
+} TelemetryState;
+
+// Contadores de tempo de uma tarefa, publicados pela própria tarefa ao fim de cada job.
+typedef struct {
+    uint64_t jobs;               // Jobs liberados
+    uint64_t deadline_misses;
+    uint64_t skipped_jobs;       // Descartados pela política de estouro
+    uint64_t degraded_jobs;      // Executados com o corpo degradado
+    double period_ms;            // Período efetivo (muda com o comando "periodo")
+    double last_computation_ms;  // Ci do último job executado
+    double mean_computation_ms;
+    double max_computation_ms;
+    double last_response_ms;     // Ri do último job executado
+    double max_response_ms;
+    double max_jitter_ms;        // Maior |J(k)| de ativação
+    double max_lateness_ms;      // Pior atraso em relação ao deadline
+} TelemetryTask;
+
+typedef struct { _Alignas(64) SeqLock lock; TelemetryState value[2]; } TelemetryStateChannel;
+typedef struct { _Alignas(64) SeqLock lock; TelemetryTask value[2]; } TelemetryTaskChannel;
+
+// Layout do segmento. O cabeçalho é escrito antes de 'magic', que é publicado
+// por último: um leitor que encontra o magic vê o cabeçalho completo.
+typedef struct {
+    atomic_uint magic;
+    uint32_t version;
+    uint32_t size;           // sizeof(TelemetrySegment) do escritor: confere o layout
+    uint32_t n_tasks;
+    int64_t pid;             // Processo da simulação
+    atomic_int active;       // 1 enquanto a simulação publica; 0 depois do fim
+    char description[TELEMETRY_TEXT_LEN]; // Condições da execução (modo, política, carga)
+    char task_names[TELEMETRY_MAX_TASKS][TELEMETRY_NAME_LEN];
+    TelemetryStateChannel state;
+    TelemetryTaskChannel tasks[TELEMETRY_MAX_TASKS];
+} TelemetrySegment;
+
+typedef struct {
+    TelemetrySegment* segment;
+    int owner;               // 1 no processo que criou o segmento (remove o nome ao fim)
+    char name[64];
+} Telemetry;
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Cria (ou recria) o segmento e publica o cabeçalho. Os blocos começam
+ * zerados, já publicados.
+ * @param name Nome POSIX do segmento (ex.: TELEMETRY_DEFAULT_NAME).
+ * @param description Texto livre gravado no cabeçalho (truncado).
+ * @param task_names Nome de cada tarefa.
+ * @param n_tasks Número de tarefas (até TELEMETRY_MAX_TASKS).
+ * @return Ponteiro para a telemetria ou NULL em caso de falha.
+ */
+Telemetry* create_telemetry(const char* name, const char* description, const char* const* task_names, int n_tasks);
+
+// Publica o estado (único escritor: a tarefa de UI).
+void telemetry_publish_state(Telemetry* telemetry, const TelemetryState* state);
+
+// Publica os contadores de uma tarefa no seu canal (único escritor: a própria tarefa).
+void telemetry_publish_task(TelemetryTaskChannel* channel, const TelemetryTask* task);
+
+/**
+ * @brief Abre um segmento existente só para leitura (processo monitor).
+ * @param name Nome POSIX do segmento.
+ * @return Ponteiro para a telemetria ou NULL se o segmento não existe ou tem
+ * outro layout (versão ou tamanho diferentes).
+ */
+Telemetry* open_telemetry(const char* name);
+
+// Copia o estado publicado mais recente (leitor de outro processo).
+void telemetry_read_state(const Telemetry* telemetry, TelemetryState* state);
+
+// Copia os contadores publicados mais recentes da tarefa i.
+void telemetry_read_task(const Telemetry* telemetry, int i, TelemetryTask* task);
+
+// Desfaz o mapeamento; no criador marca o segmento como inativo e remove o nome
+// (monitores ainda conectados continuam lendo os últimos valores).
+void free_telemetry(Telemetry* telemetry);
+
+#endif // TELEMETRY_H
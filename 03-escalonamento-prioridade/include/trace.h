@@ -0,0 +1,59 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include "histogram.h"
+
+// --- Configuração ---
+#define TRACE_MAX_CHAINS 4 // Cadeias de causa e efeito rastreadas simultaneamente
+
+// --- Estruturas de Dados ---
+// Carimbo propagado junto com cada amostra publicada: para cada cadeia, o
+// instante (CLOCK_MONOTONIC, ns) em que a amostra de origem foi produzida.
+// 0 indica que a amostra ainda não depende de nenhum dado daquela cadeia.
+typedef struct {
+    uint64_t origin_ns[TRACE_MAX_CHAINS];
+} TraceStamp;
+
+// Estatísticas de uma cadeia, coletadas pela tarefa no fim dela (escritor único).
+typedef struct {
+    const char* name;
+    const char* path;       // Descrição do caminho, ex.: "y -> v -> u -> robô"
+    Histogram age_ns;       // Idade do dado a cada job do consumidor final
+    Histogram reaction_ns;  // Tempo até a primeira ação com cada nova amostra de origem
+    uint64_t last_origin_ns;
+} TraceChain;
+
+// --- Protótipos das Funções ---
+
+// Instante atual em ns (CLOCK_MONOTONIC), a base de todos os carimbos.
+uint64_t trace_now_ns(void);
+
+// Zera um carimbo (nenhuma origem conhecida).
+void trace_stamp_clear(TraceStamp* stamp);
+
+/**
+ * @brief Inicializa as estatísticas de uma cadeia.
+ * @param chain A cadeia.
+ * @param name Nome curto para o relatório.
+ * @param path Descrição do caminho percorrido pelo dado.
+ */
+void trace_chain_init(TraceChain* chain, const char* name, const char* path);
+
+/**
+ * @brief Registra, no consumidor final, o uso de uma amostra com a origem dada:
+ * sempre a idade (now - origem) e, se a origem é nova, a reação.
+ * @param chain A cadeia.
+ * @param origin_ns Origem carimbada na amostra consumida (0 = ignora).
+ * @param now_ns Instante da ação (ex.: aplicação de u no robô).
+ */
+void trace_observe(TraceChain* chain, uint64_t origin_ns, uint64_t now_ns);
+
+/**
+ * @brief Imprime idade e reação (mínimo, média, p99, máximo) de cada cadeia.
+ * @param chains As cadeias.
+ * @param n Número de cadeias.
+ */
+void trace_print_chains(const TraceChain* chains, int n);
+
+#endif // TRACE_H
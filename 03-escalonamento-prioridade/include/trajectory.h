@@ -0,0 +1,71 @@
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+
+#include "reference.h" // ReferenceSample e ReferenceSource
+
+// --- Estrutura de Dados ---
+// Spline cúbica natural (C²) que passa por todos os waypoints, parametrizada pelo
+// comprimento de corda acumulado, com tabela de comprimento de arco para que as
+// consultas por distância e por tempo andem com velocidade constante.
+typedef struct {
+    int n_points;     // Número de waypoints (n_points - 1 segmentos)
+    double* knot;     // Parâmetro (corda acumulada) de cada waypoint
+    double* px;       // Coordenadas X dos waypoints
+    double* py;       // Coordenadas Y dos waypoints
+    double* mx;       // Segundas derivadas da spline em X nos nós
+    double* my;       // Segundas derivadas da spline em Y nos nós
+    double* arc;      // Comprimento de arco acumulado em cada nó
+    int* bucket;      // Índice uniforme de arco: primeiro segmento de cada faixa
+    int n_buckets;
+    double bucket_inv; // n_buckets / length
+    double length;    // Comprimento total do caminho (m)
+    double speed;     // Velocidade de percurso para consultas por tempo (m/s)
+    int closed;       // 1 se o último waypoint coincide com o primeiro (caminho repete)
+} SplineTrajectory;
+
+// --- Protótipos das Funções ---
+
+/**
+ * @brief Constrói a spline a partir de vetores de waypoints. Custo O(n).
+ * Waypoints consecutivos repetidos são descartados.
+ * @param x Coordenadas X dos waypoints.
+ * @param y Coordenadas Y dos waypoints.
+ * @param n Número de waypoints (>= 2).
+ * @param speed Velocidade de percurso em m/s (> 0).
+ * @return Ponteiro para a spline ou NULL em caso de falha.
+ */
+SplineTrajectory* create_spline_trajectory(const double* x, const double* y, int n, double speed);
+
+/**
+ * @brief Lê um arquivo de waypoints ("x y" por linha; '#' inicia comentário).
+ * @param filename Caminho do arquivo.
+ * @param speed Velocidade de percurso em m/s (> 0).
+ * @return Ponteiro para a spline ou NULL em caso de falha.
+ */
+SplineTrajectory* load_spline_trajectory(const char* filename, double speed);
+
+// Libera a memória da spline.
+void free_spline_trajectory(SplineTrajectory* traj);
+
+/**
+ * @brief Consulta a spline pela distância percorrida ao longo do caminho.
+ * Custo O(1) esperado (índice uniforme de arco + Newton local).
+ * @param traj A spline.
+ * @param s Distância ao longo do caminho em metros.
+ * @param out pos = r(s); vel = dr/ds (tangente unitária); acc = d²r/ds² (curvatura).
+ */
+void spline_sample_by_distance(const SplineTrajectory* traj, double s, ReferenceSample* out);
+
+/**
+ * @brief Consulta a spline pelo tempo, percorrendo-a com velocidade constante.
+ * Caminhos fechados se repetem; abertos param no último waypoint.
+ * @param traj A spline.
+ * @param t O tempo da simulação em segundos.
+ * @param out Posição, velocidade (m/s) e aceleração (m/s²) no tempo t.
+ */
+void spline_sample_by_time(const SplineTrajectory* traj, double t, ReferenceSample* out);
+
+// Adapta a spline à interface ReferenceSource (consulta por tempo).
+ReferenceSource spline_reference_source(const SplineTrajectory* traj);
+
+#endif // TRAJECTORY_H
@@ -5,8 +5,8 @@ close all;
 
 % --- 1. Constantes e Arquivos ---
 R = 0.3; % Raio do robô (D=0.6m)
-file_sem_carga = "../data/simulation_sem_carga.txt";
-file_com_carga = "../data/simulation_com_carga.txt";
+file_sem_carga = "../data/simulation_sem_carga.bin";
+file_com_carga = "../data/simulation_com_carga.bin";
 
 fprintf("Carregando dados...\n");
 if (exist(file_sem_carga, 'file') ~= 2 || exist(file_com_carga, 'file') ~= 2)
@@ -14,8 +14,11 @@ if (exist(file_sem_carga, 'file') ~= 2 || exist(file_com_carga, 'file') ~= 2)
 end
 
 % --- 2. Leitura dos dados ---
-data_sem = dlmread(file_sem_carga, " ", 1, 0);
-data_com = dlmread(file_com_carga, " ", 1, 0);
+% Logs binários (read_binlog.m); o cabeçalho registra o perfil de interferência.
+data_sem = read_binlog(file_sem_carga);
+[data_com, ~, descricao_com] = read_binlog(file_com_carga);
+carga_com = strtrim(strrep(descricao_com, "carga:", ""));
+fprintf("Perfil de carga: %s\n", carga_com);
 
 % --- 3. Extração das 6 colunas existentes ---
 t_sem = data_sem(:,1); Xc_sem = data_sem(:,2); Yc_sem = data_sem(:,3); theta_sem = data_sem(:,4);
@@ -49,7 +52,7 @@ plot(Yf_com(end), Xf_com(end), 'rx', 'MarkerSize', 10, 'LineWidth',1.5);
 
 title("Trajetória do Robô - Comparação Sem Carga vs Com Carga");
 xlabel("Posição Y (m)"); ylabel("Posição X (m)");
-legend("Sem carga","Com carga","Início sem","Fim sem","Início com","Fim com");
+legend("Sem carga",["Com carga (" carga_com ")"],"Início sem","Fim sem","Início com","Fim com");
 
 print("../data/trajetoria_comparativa.png","-dpng","-r300");
 
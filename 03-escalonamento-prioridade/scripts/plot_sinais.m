@@ -0,0 +1,55 @@
+% Script para reconstruir todos os sinais de uma execução na resolução de cada tarefa
+clear all;
+clc;
+close all;
+
+% --- 1. Arquivos ---
+% Base do log (sem ".bin"); troque para comparar outra execução (ex.: _rt, _lockfree).
+base = "../data/simulation_sem_carga";
+tarefas = {"robo", "linearizacao", "controle", "modelo", "referencia"};
+
+fprintf("Carregando sinais de %s...\n", base);
+for k = 1:numel(tarefas)
+    arquivo = [base "_" tarefas{k} ".bin"];
+    if (exist(arquivo, 'file') ~= 2)
+        error("Arquivo %s não encontrado. Execute './main' primeiro.", arquivo);
+    end
+    [sinais.(tarefas{k}), colunas.(tarefas{k})] = read_binlog(arquivo);
+    fprintf("  %-13s %6d amostras\n", tarefas{k}, rows(sinais.(tarefas{k})));
+end
+robo = sinais.robo; lin = sinais.linearizacao; ctl = sinais.controle;
+ym = sinais.modelo; ref = sinais.referencia;
+
+% --- 2. Saída do robô, modelo de referência e referência ---
+figure(1);
+subplot(2,1,1);
+plot(ref(:,1), ref(:,2), "k.", ym(:,1), ym(:,2), "b-", robo(:,1), robo(:,7), "r-");
+grid on; xlabel("t (s)"); ylabel("x (m)");
+title("Frente do robô, modelo de referência e referência (cada tarefa no seu período)");
+legend("Xref (120 ms)", "y_m x (50 ms)", "Xf (30 ms)");
+subplot(2,1,2);
+plot(ref(:,1), ref(:,3), "k.", ym(:,1), ym(:,3), "b-", robo(:,1), robo(:,8), "r-");
+grid on; xlabel("t (s)"); ylabel("y (m)");
+legend("Yref (120 ms)", "y_m y (50 ms)", "Yf (30 ms)");
+
+% --- 3. Comandos v (controle) e u (linearização), em degraus ---
+figure(2);
+subplot(2,1,1);
+stairs(ctl(:,1), ctl(:,2:3));
+grid on; xlabel("t (s)"); ylabel("v");
+title("Comando v(t) do controlador (50 ms)");
+legend("v_x", "v_y");
+subplot(2,1,2);
+stairs(lin(:,1), lin(:,2:3));
+grid on; xlabel("t (s)"); ylabel("u");
+title("Comando u(t) da linearização (40 ms)");
+legend("v (m/s)", "omega (rad/s)");
+
+% --- 4. Erro de rastreamento y_m - y, no instante de cada amostra do robô ---
+erro_x = interp1(ym(:,1), ym(:,2), robo(:,1), "previous") - robo(:,7);
+erro_y = interp1(ym(:,1), ym(:,3), robo(:,1), "previous") - robo(:,8);
+figure(3);
+plot(robo(:,1), erro_x, robo(:,1), erro_y);
+grid on; xlabel("t (s)"); ylabel("erro (m)");
+title("Erro de rastreamento y_m - y_f (resolução do robô, 30 ms)");
+legend("e_x", "e_y");
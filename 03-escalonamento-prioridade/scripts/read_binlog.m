@@ -0,0 +1,48 @@
+function [data, columns, description] = read_binlog(filename)
+% Lê um log binário do Lab 3 (formato descrito em include/binlog.h).
+%   data:        uma linha por registro, uma coluna por variável (a 1a é o tempo)
+%   columns:     nomes das colunas (cell array)
+%   description: condições da execução gravadas no cabeçalho (ex.: "carga: nenhuma")
+
+fid = fopen(filename, "r", "ieee-le");
+if (fid < 0)
+    error("Não foi possível abrir %s", filename);
+end
+
+% --- Cabeçalho ---
+magic = fread(fid, [1 8], "char=>char");
+if (!strcmp(magic(1:7), "LAB3LOG"))
+    fclose(fid);
+    error("%s não é um log binário do Lab 3", filename);
+end
+version = fread(fid, 1, "uint32");
+n_columns = fread(fid, 1, "uint32");
+record_size = fread(fid, 1, "uint32");
+header_size = fread(fid, 1, "uint32");
+fread(fid, 1, "uint64"); % index_stride: o índice não é necessário para ler tudo
+description = deblank(fread(fid, [1 128], "char=>char"));
+columns = cell(1, n_columns);
+for c = 1:n_columns
+    columns{c} = deblank(fread(fid, [1 32], "char=>char"));
+end
+if (version != 1)
+    warning("%s: versão %d do formato (esperada 1)", filename, version);
+end
+
+% --- Número de registros: pelo rodapé ou, sem ele, pelo tamanho do arquivo ---
+fseek(fid, 0, "eof");
+file_size = ftell(fid);
+n_records = floor((file_size - header_size) / record_size);
+if (file_size >= header_size + 32)
+    fseek(fid, file_size - 32, "bof");
+    footer_magic = fread(fid, [1 8], "char=>char");
+    if (strcmp(footer_magic(1:7), "LAB3IDX"))
+        n_records = fread(fid, 1, "uint64");
+    end
+end
+
+% --- Registros: n_columns doubles cada ---
+fseek(fid, header_size, "bof");
+data = fread(fid, [n_columns, n_records], "double")';
+fclose(fid);
+end
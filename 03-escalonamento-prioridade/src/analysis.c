@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "analysis.h"
+#include "textwidth.h"
+
+// Ordem de prioridade decrescente (empates pela posição na tabela).
+static int higher_priority(const AnalysisTask* tasks, int a, int b) {
+    if (tasks[a].priority != tasks[b].priority) return tasks[a].priority > tasks[b].priority;
+    return a < b;
+}
+
+// Deadline efetivo para os testes EDF: min(D, T).
+static double effective_deadline(const AnalysisTask* task) {
+    return task->d_ms < task->t_ms ? task->d_ms : task->t_ms;
+}
+
+// Recorrência da análise de tempo de resposta com jitter:
+//   w = Ci + Bi + soma_{j em hp(i)} ceil((w + Jj) / Tj) * Cj,   Ri = w + Ji.
+// Tarefas de mesma prioridade contam como interferência (caso pessimista).
+static double response_time(const AnalysisTask* tasks, int n, int i) {
+    const AnalysisTask* task = &tasks[i];
+    if (task->b_unbounded) return -1.0;
+    double limit = ANALYSIS_MAX_WINDOW_FACTOR * task->d_ms;
+    double w = task->c_ms + task->b_ms;
+    for (;;) {
+        double next = task->c_ms + task->b_ms;
+        for (int j = 0; j < n; j++) {
+            if (j == i || tasks[j].priority < task->priority) continue;
+            next += ceil((w + tasks[j].j_ms) / tasks[j].t_ms) * tasks[j].c_ms;
+        }
+        if (next > limit) return -1.0;
+        if (next <= w) return w + task->j_ms;
+        w = next;
+    }
+}
+
+// Implementação da análise.
+int analysis_run(AnalysisTask* tasks, int n, AnalysisResult* result) {
+    if (n <= 0) return -1;
+    for (int i = 0; i < n; i++) {
+        if (tasks[i].t_ms <= 0.0 || tasks[i].d_ms <= 0.0 || tasks[i].c_ms < 0.0) return -1;
+    }
+    int* order = malloc(n * sizeof(int));
+    if (order == NULL) return -1;
+
+    result->n_tasks = n;
+    result->utilization = 0.0;
+    for (int i = 0; i < n; i++) result->utilization += tasks[i].c_ms / tasks[i].t_ms;
+    result->ll_bound = n * (pow(2.0, 1.0 / n) - 1.0);
+
+    // 1. Análise de tempo de resposta exata.
+    result->rta_ok = 1;
+    for (int i = 0; i < n; i++) {
+        tasks[i].r_ms = response_time(tasks, n, i);
+        tasks[i].slack_ms = tasks[i].r_ms < 0.0 ? -INFINITY : tasks[i].d_ms - tasks[i].r_ms;
+        if (tasks[i].slack_ms < 0.0) result->rta_ok = 0;
+    }
+
+    // 2. Liu & Layland e hiperbólico com bloqueio, na ordem de prioridade: a
+    // k-ésima tarefa soma a utilização das k mais prioritárias e o seu Bi/Ti.
+    for (int i = 0; i < n; i++) order[i] = i;
+    for (int i = 1; i < n; i++) {
+        for (int k = i; k > 0 && higher_priority(tasks, order[k], order[k - 1]); k--) {
+            int tmp = order[k];
+            order[k] = order[k - 1];
+            order[k - 1] = tmp;
+        }
+    }
+    double sum_u = 0.0, product = 1.0;
+    result->ll_ok = 1;
+    result->hyperbolic = 0.0;
+    for (int k = 0; k < n; k++) {
+        const AnalysisTask* task = &tasks[order[k]];
+        double u = task->c_ms / task->t_ms;
+        double blocking = task->b_ms / task->t_ms;
+        sum_u += u;
+        if (sum_u + blocking > (k + 1) * (pow(2.0, 1.0 / (k + 1)) - 1.0)) result->ll_ok = 0;
+        double h = product * (u + blocking + 1.0);
+        if (h > result->hyperbolic) result->hyperbolic = h;
+        product *= u + 1.0;
+    }
+    result->hyperbolic_ok = result->hyperbolic <= 2.0;
+
+    // 3. EDF com bloqueio (Baker, SRP): em ordem de deadline crescente,
+    //   soma_{i<=k} Ci/Di + Bk/Dk <= 1 para todo k.
+    for (int i = 1; i < n; i++) {
+        for (int k = i; k > 0 && effective_deadline(&tasks[order[k]]) < effective_deadline(&tasks[order[k - 1]]); k--) {
+            int tmp = order[k];
+            order[k] = order[k - 1];
+            order[k - 1] = tmp;
+        }
+    }
+    double density = 0.0;
+    result->edf_density = 0.0;
+    for (int k = 0; k < n; k++) {
+        const AnalysisTask* task = &tasks[order[k]];
+        double d = effective_deadline(task);
+        density += task->c_ms / d;
+        if (density + task->b_ms / d > result->edf_density) result->edf_density = density + task->b_ms / d;
+    }
+    result->edf_ok = result->edf_density <= 1.0;
+
+    // Bi ilimitado: os números acima usam só a posse medida, então não provam nada.
+    for (int i = 0; i < n; i++) {
+        if (!tasks[i].b_unbounded) continue;
+        result->rta_ok = result->ll_ok = result->hyperbolic_ok = result->edf_ok = -1;
+        break;
+    }
+
+    free(order);
+    return 0;
+}
+
+// Implementação do relatório.
+void analysis_print(const AnalysisTask* tasks, int n, const AnalysisResult* result) {
+    printf("\n--- Análise de Escalonabilidade (Ci, Bi e Ji medidos nesta execução, em ms) ---\n");
+    printf("| Tarefa         | Prio |       Ci |     Ti |     Di |       Bi |       Ji |       Ri |    Folga |\n");
+    printf("|----------------|------|----------|--------|--------|----------|----------|----------|----------|\n");
+    for (int i = 0; i < n; i++) {
+        const AnalysisTask* task = &tasks[i];
+        printf("| %-*s | %4d | %8.3f | %6.1f | %6.1f | %8.3f | %8.3f |", text_field_width(task->name, 14), task->name,
+               task->priority, task->c_ms, task->t_ms, task->d_ms, task->b_ms, task->j_ms);
+        if (task->b_unbounded) {
+            printf(" %8s | %8s |\n", "ilimit.", "-");
+        } else if (task->r_ms < 0.0) {
+            printf(" %8s | %8s |\n", "diverge", "-");
+        } else {
+            printf(" %8.3f | %8.3f |\n", task->r_ms, task->slack_ms);
+        }
+    }
+    printf("  - Utilização U = %.4f (%.2f%%)\n", result->utilization, result->utilization * 100.0);
+    if (result->rta_ok < 0) {
+        printf("  - Sem veredito: há mutexes sem herança de prioridade, então o bloqueio (Bi) não tem limite.\n");
+        return;
+    }
+    printf("  - Liu & Layland com bloqueio (limite %.4f para n = %d): %s\n", result->ll_bound, result->n_tasks,
+           result->ll_ok ? "escalonável" : "inconclusivo");
+    printf("  - Hiperbólico com bloqueio: max prod(Ui + 1) = %.4f <= 2: %s\n", result->hyperbolic,
+           result->hyperbolic_ok ? "escalonável" : "inconclusivo");
+    printf("  - Tempo de resposta exato (prioridade fixa): %s\n",
+           result->rta_ok ? "todas as tarefas cumprem Ri <= Di" : "há tarefas com Ri > Di");
+    printf("  - EDF com bloqueio (SRP): carga máxima %.4f <= 1: %s\n", result->edf_density,
+           result->edf_ok ? "escalonável" : "não escalonável");
+}
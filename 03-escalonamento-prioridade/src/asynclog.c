@@ -0,0 +1,162 @@
+#define _DEFAULT_SOURCE // Habilita nanosleep
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "asynclog.h"
+#include "textwidth.h"
+
+// Implementação da criação do logger.
+AsyncLogger* create_async_logger(void) {
+    // Os anéis têm campos alinhados à linha de cache: calloc não garante isso.
+    AsyncLogger* logger = aligned_alloc(_Alignof(AsyncLogger), sizeof(AsyncLogger));
+    if (logger == NULL) return NULL;
+    memset(logger, 0, sizeof(*logger));
+    atomic_init(&logger->running, 0);
+    return logger;
+}
+
+// Implementação do registro de um produtor.
+LogStream* async_logger_add_stream(AsyncLogger* logger, const char* name, FILE* file) {
+    if (logger->started || logger->n_streams >= ASYNC_LOG_MAX_STREAMS) return NULL;
+    LogStream* stream = &logger->streams[logger->n_streams++];
+    atomic_init(&stream->head, 0);
+    atomic_init(&stream->tail, 0);
+    stream->dropped = 0;
+    stream->high_water = 0;
+    stream->name = name;
+    stream->file = file;
+    stream->binlog = NULL;
+    stream->written = 0;
+    stream->failed = 0;
+    return stream;
+}
+
+// Implementação do registro de um produtor binário.
+LogStream* async_logger_add_binary_stream(AsyncLogger* logger, const char* name, BinLog* binlog) {
+    if (binlog->n_columns > ASYNC_LOG_MAX_VALUES) return NULL; // Um registro do anel não caberia
+    LogStream* stream = async_logger_add_stream(logger, name, NULL);
+    if (stream != NULL) stream->binlog = binlog;
+    return stream;
+}
+
+// Implementação do envio (lado do produtor).
+int async_log_push(LogStream* stream, const double* values, int n_values) {
+    uint_fast64_t head = atomic_load_explicit(&stream->head, memory_order_relaxed);
+    uint_fast64_t tail = atomic_load_explicit(&stream->tail, memory_order_acquire);
+    if (head - tail >= ASYNC_LOG_CAPACITY) {
+        stream->dropped++;
+        return -1;
+    }
+    if (n_values > ASYNC_LOG_MAX_VALUES) n_values = ASYNC_LOG_MAX_VALUES;
+
+    LogRecord* record = &stream->slots[head & (ASYNC_LOG_CAPACITY - 1)];
+    record->n_values = n_values;
+    memcpy(record->values, values, n_values * sizeof(double));
+    // A publicação de head (release) torna o registro visível ao escritor.
+    atomic_store_explicit(&stream->head, head + 1, memory_order_release);
+
+    if (head + 1 - tail > stream->high_water) stream->high_water = head + 1 - tail;
+    return 0;
+}
+
+// Grava um registro no destino do anel. Retorna 0 ou -1 se não foi gravado.
+static int write_record(LogStream* stream, const LogRecord* record) {
+    if (stream->binlog != NULL) {
+        // O log binário tem registros de tamanho fixo: outro número de valores
+        // desalinharia todos os registros seguintes.
+        if (record->n_values != stream->binlog->n_columns) return -1;
+        return binlog_append(stream->binlog, record->values);
+    }
+    for (int i = 0; i < record->n_values; i++) {
+        fprintf(stream->file, i == 0 ? "%f" : " %f", record->values[i]);
+    }
+    return fputc('\n', stream->file) == EOF ? -1 : 0;
+}
+
+// Grava tudo o que o produtor publicou até agora; devolve o número de registros
+// retirados do anel (gravados ou não).
+static uint64_t drain_stream(LogStream* stream) {
+    uint_fast64_t tail = atomic_load_explicit(&stream->tail, memory_order_relaxed);
+    uint_fast64_t head = atomic_load_explicit(&stream->head, memory_order_acquire);
+    uint64_t count = head - tail;
+    for (; tail != head; tail++) {
+        const LogRecord* record = &stream->slots[tail & (ASYNC_LOG_CAPACITY - 1)];
+        if (write_record(stream, record) == 0) {
+            stream->written++;
+        } else {
+            stream->failed++;
+        }
+        // Libera o slot só depois de gravado.
+        atomic_store_explicit(&stream->tail, tail + 1, memory_order_release);
+    }
+    if (count > 0) {
+        if (stream->binlog != NULL) binlog_flush(stream->binlog); else fflush(stream->file);
+    }
+    return count;
+}
+
+// Uma passada por todos os anéis (um lote).
+static void drain_all(AsyncLogger* logger) {
+    uint64_t batch = 0;
+    for (int i = 0; i < logger->n_streams; i++) {
+        batch += drain_stream(&logger->streams[i]);
+    }
+    if (batch > 0) logger->batches++;
+    if (batch > logger->max_batch) logger->max_batch = batch;
+}
+
+// Thread escritora: dorme entre os lotes; o disco só é tocado aqui.
+static void* writer_thread(void* arg) {
+    AsyncLogger* logger = (AsyncLogger*) arg;
+    const struct timespec interval = { 0, ASYNC_LOG_FLUSH_MS * 1000000L };
+    while (atomic_load(&logger->running)) {
+        nanosleep(&interval, NULL);
+        drain_all(logger);
+    }
+    drain_all(logger); // O que os produtores publicaram antes de pararem
+    return NULL;
+}
+
+// Implementação do início do escritor.
+int async_logger_start(AsyncLogger* logger) {
+    atomic_store(&logger->running, 1);
+    if (pthread_create(&logger->writer, NULL, writer_thread, logger) != 0) {
+        atomic_store(&logger->running, 0);
+        return -1;
+    }
+    logger->started = 1;
+    return 0;
+}
+
+// Implementação da parada.
+void async_logger_stop(AsyncLogger* logger) {
+    if (logger == NULL || !logger->started) return;
+    atomic_store(&logger->running, 0);
+    pthread_join(logger->writer, NULL);
+    logger->started = 0;
+}
+
+// Implementação do relatório.
+void async_logger_print_stats(const AsyncLogger* logger) {
+    printf("\n--- Log Assíncrono (anéis de %d registros, lotes a cada %d ms) ---\n", ASYNC_LOG_CAPACITY,
+           ASYNC_LOG_FLUSH_MS);
+    printf("| Produtor         |  Gravados | Descartados |  Falhas | Marca d'água |\n");
+    printf("|------------------|-----------|-------------|---------|--------------|\n");
+    for (int i = 0; i < logger->n_streams; i++) {
+        const LogStream* stream = &logger->streams[i];
+        printf("| %-*s | %9lu | %11lu | %7lu | %5lu (%3.0f%%) |\n", text_field_width(stream->name, 16), stream->name,
+               (unsigned long) stream->written, (unsigned long) stream->dropped, (unsigned long) stream->failed,
+               (unsigned long) stream->high_water, 100.0 * stream->high_water / ASYNC_LOG_CAPACITY);
+    }
+    printf("  - Lotes gravados: %lu (maior: %lu registros)\n", (unsigned long) logger->batches,
+           (unsigned long) logger->max_batch);
+}
+
+// Implementação da liberação.
+void free_async_logger(AsyncLogger* logger) {
+    if (logger == NULL) return;
+    async_logger_stop(logger);
+    free(logger);
+}
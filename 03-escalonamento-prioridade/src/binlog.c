@@ -0,0 +1,187 @@
+#define _DEFAULT_SOURCE // Habilita mmap e fstat
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "binlog.h"
+
+// Implementação da criação.
+BinLog* create_binlog(const char* filename, const char* description, const char* const* columns, int n_columns) {
+    if (n_columns < 1 || n_columns > BINLOG_MAX_COLUMNS) return NULL;
+    BinLog* log = calloc(1, sizeof(BinLog));
+    if (log == NULL) return NULL;
+    log->file = fopen(filename, "wb");
+    if (log->file == NULL) {
+        free(log);
+        return NULL;
+    }
+    log->n_columns = n_columns;
+    snprintf(log->filename, sizeof(log->filename), "%s", filename);
+
+    BinLogHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BINLOG_MAGIC, sizeof(BINLOG_MAGIC));
+    header.version = BINLOG_VERSION;
+    header.n_columns = (uint32_t) n_columns;
+    header.record_size = (uint32_t) (n_columns * sizeof(double));
+    header.header_size = (uint32_t) (sizeof(header) + n_columns * BINLOG_NAME_LEN);
+    header.index_stride = BINLOG_INDEX_STRIDE;
+    snprintf(header.description, sizeof(header.description), "%s", description);
+    fwrite(&header, sizeof(header), 1, log->file);
+    for (int i = 0; i < n_columns; i++) {
+        char name[BINLOG_NAME_LEN] = { 0 };
+        snprintf(name, sizeof(name), "%s", columns[i]);
+        fwrite(name, sizeof(name), 1, log->file);
+    }
+    if (ferror(log->file)) {
+        fclose(log->file);
+        free(log);
+        return NULL;
+    }
+    return log;
+}
+
+// Implementação da escrita de um registro: o índice é acessório, então uma
+// falha ao ampliá-lo não custa o registro.
+int binlog_append(BinLog* log, const double* values) {
+    if (log->n_records % BINLOG_INDEX_STRIDE == 0) {
+        if (log->n_index == log->index_capacity) {
+            uint64_t capacity = log->index_capacity ? 2 * log->index_capacity : 64;
+            BinLogIndexEntry* index = realloc(log->index, capacity * sizeof(BinLogIndexEntry));
+            if (index != NULL) {
+                log->index = index;
+                log->index_capacity = capacity;
+            }
+        }
+        if (log->n_index < log->index_capacity) {
+            log->index[log->n_index++] = (BinLogIndexEntry) { values[0], log->n_records };
+        } else {
+            log->index_failures++;
+        }
+    }
+    if (fwrite(values, sizeof(double), log->n_columns, log->file) != (size_t) log->n_columns) return -1;
+    log->n_records++;
+    return 0;
+}
+
+// Implementação do flush.
+void binlog_flush(BinLog* log) {
+    fflush(log->file);
+}
+
+// Implementação do fechamento: índice e rodapé no fim do arquivo.
+void free_binlog(BinLog* log) {
+    if (log == NULL) return;
+    BinLogFooter footer;
+    memset(&footer, 0, sizeof(footer));
+    memcpy(footer.magic, BINLOG_FOOTER_MAGIC, sizeof(BINLOG_FOOTER_MAGIC));
+    footer.n_records = log->n_records;
+    footer.index_offset = (uint64_t) ftell(log->file);
+    footer.n_index = log->n_index;
+    fwrite(log->index, sizeof(BinLogIndexEntry), log->n_index, log->file);
+    fwrite(&footer, sizeof(footer), 1, log->file);
+    fclose(log->file);
+    if (log->index_failures > 0) {
+        fprintf(stderr, "[binlog] AVISO: %s: %lu entradas do índice omitidas por falta de memória "
+                "(registros completos; busca por tempo mais lenta).\n", log->filename,
+                (unsigned long) log->index_failures);
+    }
+    free(log->index);
+    free(log);
+}
+
+// --- Leitura ---
+
+// Implementação da abertura: só o cabeçalho e o rodapé são lidos; os registros
+// são acessados diretamente no mapeamento.
+BinLogReader* open_binlog_reader(const char* filename) {
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        perror(filename);
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(BinLogHeader)) {
+        fprintf(stderr, "%s: arquivo vazio ou ilegível.\n", filename);
+        close(fd);
+        return NULL;
+    }
+    size_t size = (size_t) st.st_size;
+    const unsigned char* map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        perror(filename);
+        return NULL;
+    }
+
+    const BinLogHeader* header = (const BinLogHeader*) map;
+    if (memcmp(header->magic, BINLOG_MAGIC, sizeof(BINLOG_MAGIC)) != 0 || header->version != BINLOG_VERSION ||
+        header->n_columns < 1 || header->n_columns > BINLOG_MAX_COLUMNS ||
+        header->record_size != header->n_columns * sizeof(double) || header->header_size > size) {
+        fprintf(stderr, "%s: não é um log binário versão %d.\n", filename, BINLOG_VERSION);
+        munmap((void*) map, size);
+        return NULL;
+    }
+
+    BinLogReader* reader = calloc(1, sizeof(BinLogReader));
+    if (reader == NULL) {
+        munmap((void*) map, size);
+        return NULL;
+    }
+    reader->map = map;
+    reader->map_size = size;
+    reader->header = header;
+    reader->columns = (const char (*)[BINLOG_NAME_LEN]) (map + sizeof(BinLogHeader));
+    reader->records = (const double*) (map + header->header_size);
+
+    // Com rodapé: contagem e índice gravados ao fechar. Sem rodapé: registros
+    // completos que couberem no arquivo.
+    const BinLogFooter* footer = (const BinLogFooter*) (map + size - sizeof(BinLogFooter));
+    if (size >= header->header_size + sizeof(BinLogFooter) &&
+        memcmp(footer->magic, BINLOG_FOOTER_MAGIC, sizeof(BINLOG_FOOTER_MAGIC)) == 0 &&
+        footer->index_offset == header->header_size + footer->n_records * header->record_size &&
+        footer->index_offset + footer->n_index * sizeof(BinLogIndexEntry) + sizeof(BinLogFooter) == size) {
+        reader->n_records = footer->n_records;
+        reader->index = (const BinLogIndexEntry*) (map + footer->index_offset);
+        reader->n_index = footer->n_index;
+    } else {
+        reader->n_records = (size - header->header_size) / header->record_size;
+    }
+    return reader;
+}
+
+// Implementação do acesso a um registro.
+const double* binlog_record(const BinLogReader* reader, uint64_t i) {
+    return reader->records + i * reader->header->n_columns;
+}
+
+// Implementação da busca por tempo.
+uint64_t binlog_seek_time(const BinLogReader* reader, double t) {
+    uint64_t lo = 0, hi = reader->n_records;
+    if (reader->index != NULL && reader->n_index > 0) {
+        // Última entrada do índice com tempo < t: o registro procurado está no bloco dela.
+        uint64_t a = 0, b = reader->n_index;
+        while (a < b) {
+            uint64_t mid = a + (b - a) / 2;
+            if (reader->index[mid].t < t) a = mid + 1; else b = mid;
+        }
+        if (a > 0) lo = reader->index[a - 1].record;
+        if (a < reader->n_index) hi = reader->index[a].record;
+    }
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (binlog_record(reader, mid)[0] < t) lo = mid + 1; else hi = mid;
+    }
+    return lo;
+}
+
+// Implementação da liberação do leitor.
+void free_binlog_reader(BinLogReader* reader) {
+    if (reader == NULL) return;
+    munmap((void*) reader->map, reader->map_size);
+    free(reader);
+}
@@ -1,6 +1,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include "control.h"
+#include "fastmath.h"
 
 // Aloca memória para a estrutura e matrizes do controlador.
 Controller* create_controller(double* alpha1, double* alpha2) {
@@ -50,13 +51,15 @@ void calculate_controller_output_v(Controller* ctrl, const RobotState* robot_sta
 void calculate_linearization_u(Controller* ctrl, const RobotState* robot_state) {
     double theta = robot_state->x->data[2][0];
     double R = ROBOT_DIAMETER / 2.0;
+    double sin_theta, cos_theta;
+    fast_sincos(theta, &sin_theta, &cos_theta);
 
     // 1. Monta a matriz L(x)
     Matrix* L = create_matrix(2, 2);
-    L->data[0][0] = cos(theta);
-    L->data[0][1] = -R * sin(theta);
-    L->data[1][0] = sin(theta);
-    L->data[1][1] = R * cos(theta);
+    L->data[0][0] = cos_theta;
+    L->data[0][1] = -R * sin_theta;
+    L->data[1][0] = sin_theta;
+    L->data[1][1] = R * cos_theta;
 
     // 2. Calcula a inversa L^-1(x)
     Matrix* L_inv = inverse(L);
@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "cyclic.h"
+
+static long gcd(long a, long b) {
+    while (b != 0) {
+        long r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+// Implementação da geração da tabela.
+CyclicSchedule* create_cyclic_schedule(const double* periods_s, int n_tasks) {
+    if (n_tasks <= 0) return NULL;
+
+    // 1. Períodos em ms inteiros; quadro menor = MDC, quadro maior = MMC.
+    int periods_ms[n_tasks];
+    long frame = 0, hyper = 1;
+    for (int i = 0; i < n_tasks; i++) {
+        double ms = periods_s[i] * 1000.0;
+        periods_ms[i] = (int) lround(ms);
+        if (periods_ms[i] <= 0 || fabs(ms - periods_ms[i]) > 1e-6) return NULL;
+        frame = gcd(frame, periods_ms[i]);
+        hyper = hyper / gcd(hyper, periods_ms[i]) * periods_ms[i];
+        if (hyper > CYCLIC_MAX_HYPERPERIOD_MS) return NULL;
+    }
+    for (int i = 0; i < n_tasks; i++) {
+        // Um quadro inteiro cabe entre a liberação e o deadline de cada job.
+        if (2 * frame - gcd(frame, periods_ms[i]) > periods_ms[i]) return NULL;
+    }
+
+    // 2. Ordem Rate Monotonic dentro do quadro (estável para períodos iguais).
+    int order[n_tasks];
+    for (int i = 0; i < n_tasks; i++) order[i] = i;
+    for (int i = 1; i < n_tasks; i++) {
+        int key = order[i], j = i - 1;
+        while (j >= 0 && periods_ms[order[j]] > periods_ms[key]) {
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = key;
+    }
+
+    CyclicSchedule* schedule = (CyclicSchedule*) malloc(sizeof(CyclicSchedule));
+    if (schedule == NULL) return NULL;
+    schedule->n_tasks = n_tasks;
+    schedule->minor_frame_ms = (int) frame;
+    schedule->hyperperiod_ms = (int) hyper;
+    schedule->n_frames = (int) (hyper / frame);
+
+    int total_jobs = 0;
+    for (int i = 0; i < n_tasks; i++) total_jobs += (int) (hyper / periods_ms[i]);
+    schedule->frame_offset = (int*) malloc((schedule->n_frames + 1) * sizeof(int));
+    schedule->frame_tasks = (int*) malloc(total_jobs * sizeof(int));
+    if (schedule->frame_offset == NULL || schedule->frame_tasks == NULL) {
+        free_cyclic_schedule(schedule);
+        return NULL;
+    }
+
+    // 3. Cada quadro recebe as tarefas cujo período divide o seu instante inicial.
+    int k = 0;
+    for (int f = 0; f < schedule->n_frames; f++) {
+        schedule->frame_offset[f] = k;
+        long start_ms = (long) f * frame;
+        for (int i = 0; i < n_tasks; i++) {
+            if (start_ms % periods_ms[order[i]] == 0) schedule->frame_tasks[k++] = order[i];
+        }
+    }
+    schedule->frame_offset[schedule->n_frames] = k;
+    return schedule;
+}
+
+// Implementação da liberação.
+void free_cyclic_schedule(CyclicSchedule* schedule) {
+    if (schedule == NULL) return;
+    free(schedule->frame_offset);
+    free(schedule->frame_tasks);
+    free(schedule);
+}
+
+// Implementação da impressão.
+void cyclic_schedule_print(const CyclicSchedule* schedule, const char* const* names) {
+    printf("\n--- Tabela do Executivo Cíclico ---\n");
+    printf("  - Quadro menor: %d ms\n", schedule->minor_frame_ms);
+    printf("  - Quadro maior (hiperperíodo): %d ms (%d quadros, %d jobs)\n", schedule->hyperperiod_ms,
+           schedule->n_frames, schedule->frame_offset[schedule->n_frames]);
+    for (int f = 0; f < schedule->n_frames; f++) {
+        int first = schedule->frame_offset[f], last = schedule->frame_offset[f + 1];
+        if (first == last) continue;
+        printf("  %4d ms:", f * schedule->minor_frame_ms);
+        for (int k = first; k < last; k++) {
+            printf(" %s%s", names[schedule->frame_tasks[k]], k + 1 < last ? "," : "");
+        }
+        printf("\n");
+    }
+}
@@ -0,0 +1,129 @@
+#define _DEFAULT_SOURCE // Habilita nanosleep
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "dashboard.h"
+
+// Sequências ANSI usadas: limpar a tela, posicionar o cursor e apagar até o fim da linha.
+#define ANSI_CLEAR_SCREEN "\x1b[2J"
+#define ANSI_ERASE_LINE "\x1b[K"
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+// Implementação da criação.
+Dashboard* create_dashboard(DashboardFormatFn format, void* ctx, int period_ms) {
+    Dashboard* dashboard = calloc(1, sizeof(Dashboard));
+    if (dashboard == NULL) return NULL;
+    dashboard->format = format;
+    dashboard->ctx = ctx;
+    dashboard->period_ms = period_ms;
+    dashboard->enabled = isatty(STDOUT_FILENO);
+    atomic_init(&dashboard->running, 0);
+    return dashboard;
+}
+
+// Acrescenta texto ao buffer do quadro.
+static size_t append(char* buffer, size_t used, const char* text) {
+    size_t len = strlen(text);
+    if (used + len >= DASHBOARD_BUFFER_BYTES) len = DASHBOARD_BUFFER_BYTES - 1 - used;
+    memcpy(buffer + used, text, len);
+    return used + len;
+}
+
+// Monta e escreve um quadro: só as linhas diferentes do quadro anterior.
+static void render(Dashboard* dashboard) {
+    DashboardFrame frame;
+    memset(&frame, 0, sizeof(frame));
+    uint64_t start = now_ns();
+    dashboard->format(dashboard->ctx, &frame);
+    if (frame.n_rows > DASHBOARD_MAX_ROWS) frame.n_rows = DASHBOARD_MAX_ROWS;
+
+    char* buffer = dashboard->buffer;
+    size_t used = 0;
+    char move[32];
+    if (!dashboard->drawn) used = append(buffer, used, ANSI_CLEAR_SCREEN);
+    int rows = frame.n_rows > dashboard->shown.n_rows ? frame.n_rows : dashboard->shown.n_rows;
+    for (int r = 0; r < rows; r++) {
+        if (dashboard->drawn && strcmp(frame.rows[r], dashboard->shown.rows[r]) == 0) continue;
+        snprintf(move, sizeof(move), "\x1b[%d;1H", r + 1);
+        used = append(buffer, used, move);
+        used = append(buffer, used, frame.rows[r]);
+        used = append(buffer, used, ANSI_ERASE_LINE);
+        dashboard->rows_written++;
+    }
+    snprintf(move, sizeof(move), "\x1b[%d;%dH", frame.cursor_row + 1, frame.cursor_col + 1);
+    used = append(buffer, used, move);
+
+    // Um único write() por quadro.
+    ssize_t written = write(STDOUT_FILENO, buffer, used);
+    if (written > 0) dashboard->bytes_written += (uint64_t) written;
+    dashboard->shown = frame;
+    dashboard->drawn = 1;
+    dashboard->frames++;
+    uint64_t elapsed = now_ns() - start;
+    if (elapsed > dashboard->max_render_ns) dashboard->max_render_ns = elapsed;
+}
+
+static void* dashboard_thread(void* arg) {
+    Dashboard* dashboard = (Dashboard*) arg;
+    const struct timespec interval = { dashboard->period_ms / 1000, (dashboard->period_ms % 1000) * 1000000L };
+    while (atomic_load(&dashboard->running)) {
+        render(dashboard);
+        nanosleep(&interval, NULL);
+    }
+    render(dashboard); // Último estado antes dos relatórios
+    return NULL;
+}
+
+// Implementação do início.
+int dashboard_start(Dashboard* dashboard) {
+    if (!dashboard->enabled) return 0;
+    atomic_store(&dashboard->running, 1);
+    if (pthread_create(&dashboard->thread, NULL, dashboard_thread, dashboard) != 0) {
+        atomic_store(&dashboard->running, 0);
+        return -1;
+    }
+    dashboard->started = 1;
+    return 0;
+}
+
+// Implementação da parada.
+void dashboard_stop(Dashboard* dashboard) {
+    if (dashboard == NULL || !dashboard->started) return;
+    atomic_store(&dashboard->running, 0);
+    pthread_join(dashboard->thread, NULL);
+    dashboard->started = 0;
+    // Cursor na linha seguinte ao painel.
+    printf("\x1b[%d;1H\n", dashboard->shown.n_rows);
+    fflush(stdout);
+}
+
+// Implementação do relatório.
+void dashboard_print_stats(const Dashboard* dashboard) {
+    printf("\n--- Painel do Terminal ---\n");
+    if (!dashboard->enabled) {
+        printf("  - Desativado: a saída padrão não é um terminal.\n");
+        return;
+    }
+    printf("  - Quadros: %lu (a cada %d ms, fora das tarefas periódicas)\n", (unsigned long) dashboard->frames,
+           dashboard->period_ms);
+    printf("  - Linhas reescritas: %lu (%.1f por quadro)\n", (unsigned long) dashboard->rows_written,
+           dashboard->frames ? (double) dashboard->rows_written / dashboard->frames : 0.0);
+    printf("  - Bytes escritos: %lu (%.0f por quadro)\n", (unsigned long) dashboard->bytes_written,
+           dashboard->frames ? (double) dashboard->bytes_written / dashboard->frames : 0.0);
+    printf("  - Maior custo de um quadro: %.3f ms\n", dashboard->max_render_ns / 1e6);
+}
+
+// Implementação da liberação.
+void free_dashboard(Dashboard* dashboard) {
+    if (dashboard == NULL) return;
+    dashboard_stop(dashboard);
+    free(dashboard);
+}
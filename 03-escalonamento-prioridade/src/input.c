@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include "input.h"
+
+// Implementação da criação.
+InputReader* create_input_reader(InputLineFn handler, void* ctx) {
+    InputReader* reader = calloc(1, sizeof(InputReader));
+    if (reader == NULL) return NULL;
+    reader->handler = handler;
+    reader->ctx = ctx;
+    atomic_init(&reader->running, 0);
+    return reader;
+}
+
+// Entrega a linha corrente ao tratador e recomeça uma nova.
+static void deliver_line(InputReader* reader) {
+    reader->line[reader->length] = '\0';
+    reader->handler(reader->ctx, reader->line);
+    reader->lines++;
+    reader->length = 0;
+    reader->overflow = 0;
+}
+
+// Acrescenta os bytes lidos à linha corrente e entrega cada linha completa.
+static void consume(InputReader* reader, const char* data, ssize_t n) {
+    for (ssize_t i = 0; i < n; i++) {
+        if (data[i] == '\n') {
+            deliver_line(reader);
+        } else if (data[i] == '\r') {
+            continue;
+        } else if (reader->length < INPUT_LINE_MAX - 1) {
+            reader->line[reader->length++] = data[i];
+        } else if (!reader->overflow) {
+            reader->overflow = 1; // O resto da linha é ignorado
+            reader->truncated++;
+        }
+    }
+}
+
+static void* input_thread(void* arg) {
+    InputReader* reader = (InputReader*) arg;
+    struct pollfd pfd = { STDIN_FILENO, POLLIN, 0 };
+    char data[256];
+    while (atomic_load(&reader->running) && !reader->eof) {
+        int ready = poll(&pfd, 1, INPUT_POLL_MS);
+        if (ready < 0 && errno != EINTR) break;
+        if (ready <= 0) continue;
+        ssize_t n = read(STDIN_FILENO, data, sizeof(data));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            // Fim da entrada (ex.: ./main < /dev/null). Uma última linha sem '\n'
+            // (ex.: printf 'p' | ./main) também é um comando.
+            reader->eof = 1;
+            if (reader->length > 0 || reader->overflow) deliver_line(reader);
+            break;
+        }
+        consume(reader, data, n);
+    }
+    return NULL;
+}
+
+// Implementação do início.
+int input_reader_start(InputReader* reader) {
+    atomic_store(&reader->running, 1);
+    if (pthread_create(&reader->thread, NULL, input_thread, reader) != 0) {
+        atomic_store(&reader->running, 0);
+        return -1;
+    }
+    reader->started = 1;
+    return 0;
+}
+
+// Implementação da parada.
+void input_reader_stop(InputReader* reader) {
+    if (reader == NULL || !reader->started) return;
+    atomic_store(&reader->running, 0);
+    pthread_join(reader->thread, NULL);
+    reader->started = 0;
+}
+
+// Implementação da liberação.
+void free_input_reader(InputReader* reader) {
+    if (reader == NULL) return;
+    input_reader_stop(reader);
+    free(reader);
+}
@@ -0,0 +1,340 @@
+#define _GNU_SOURCE // Habilita pthread_setaffinity_np e syscall()
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include "load.h"
+
+#define NSEC_PER_SEC 1000000000L
+#define CACHE_LINE 64
+#define DISK_CHUNK_BYTES (256u << 10)  // Bloco de cada write() do perfil de disco
+#define CACHE_MAX_BYTES (256u << 20)   // Teto do conjunto do perfil de cache (L3 muito grandes)
+#define CACHE_FALLBACK_BYTES (8u << 20)
+#define PAGEFAULT_DEFAULT_BYTES (4u << 20) // Região mapeada e desfeita a cada fatia
+
+static const char* const profile_names[NUM_LOAD_PROFILES] = {
+    [LOAD_CPU] = "cpu",
+    [LOAD_MEMORY] = "memoria",
+    [LOAD_CACHE] = "cache",
+    [LOAD_PAGEFAULT] = "paginas",
+    [LOAD_SYSCALL] = "syscall",
+    [LOAD_DISK] = "disco",
+};
+
+// Unidade de LoadWorker.operations em cada perfil, para o relatório.
+static const char* const operation_units[NUM_LOAD_PROFILES] = {
+    [LOAD_CPU] = "iterações de sin()",
+    [LOAD_MEMORY] = "MiB copiados",
+    [LOAD_CACHE] = "linhas de cache tocadas",
+    [LOAD_PAGEFAULT] = "faltas de página",
+    [LOAD_SYSCALL] = "chamadas de sistema",
+    [LOAD_DISK] = "MiB gravados",
+};
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+// Gerador xorshift64: endereços aleatórios baratos para o perfil de cache.
+static uint64_t xorshift64(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *state = x;
+}
+
+// Conjunto de trabalho padrão de cada perfil.
+static size_t default_bytes(LoadProfile profile) {
+    if (profile == LOAD_CACHE) {
+        long llc = sysconf(_SC_LEVEL3_CACHE_SIZE);
+        if (llc <= 0) llc = sysconf(_SC_LEVEL2_CACHE_SIZE);
+        size_t bytes = llc > 0 ? (size_t) llc : CACHE_FALLBACK_BYTES;
+        return bytes < CACHE_MAX_BYTES ? bytes : CACHE_MAX_BYTES;
+    }
+    if (profile == LOAD_PAGEFAULT) return PAGEFAULT_DEFAULT_BYTES;
+    if (profile == LOAD_CPU || profile == LOAD_SYSCALL) return 0;
+    return (size_t) LOAD_DEFAULT_MIB << 20;
+}
+
+// Implementação da configuração padrão.
+void load_config_default(LoadConfig* config) {
+    config->profile = LOAD_CPU;
+    config->threads = 1;
+    config->duty = 1.0;
+    config->window_ms = LOAD_DEFAULT_WINDOW_MS;
+    config->bytes = 0;
+    config->dir = "data";
+}
+
+// Implementação do nome do perfil.
+const char* load_profile_name(LoadProfile profile) {
+    return (profile >= 0 && profile < NUM_LOAD_PROFILES) ? profile_names[profile] : "?";
+}
+
+// Implementação da leitura do perfil.
+int load_config_parse(const char* spec, LoadConfig* config) {
+    char name[32];
+    int threads = config->threads;
+    double duty = config->duty;
+    double mib = config->bytes / (double) (1 << 20);
+    int fields = sscanf(spec, "%31[^:]:%d:%lf:%lf", name, &threads, &duty, &mib);
+    if (fields < 1) return -1;
+
+    int profile = -1;
+    for (int i = 0; i < NUM_LOAD_PROFILES; i++) {
+        if (strcmp(name, profile_names[i]) == 0) profile = i;
+    }
+    if (profile < 0 || threads < 1 || threads > LOAD_MAX_THREADS || duty <= 0.0 || duty > 1.0 || mib < 0.0) {
+        return -1;
+    }
+    config->profile = (LoadProfile) profile;
+    config->threads = threads;
+    config->duty = duty;
+    config->bytes = (size_t) (mib * (1 << 20));
+    return 0;
+}
+
+// Implementação da descrição.
+void load_config_describe(const LoadConfig* config, char* buffer, size_t size) {
+    size_t bytes = config->bytes ? config->bytes : default_bytes(config->profile);
+    int n = snprintf(buffer, size, "%s threads=%d ciclo=%.0f%% janela=%dms", load_profile_name(config->profile),
+                     config->threads, config->duty * 100.0, config->window_ms);
+    if (bytes > 0 && n >= 0 && (size_t) n < size) {
+        snprintf(buffer + n, size - n, " conjunto=%zuMiB", bytes >> 20);
+    }
+}
+
+// --- Corpos de Carga ---
+// Cada chamada faz uma fatia curta de trabalho (bem abaixo de 1 ms), para que a
+// fase ativa do ciclo termine perto do instante previsto.
+
+static void work_cpu(LoadWorker* w) {
+    volatile double x = (double) w->operations;
+    for (int i = 0; i < 1000; i++) x = sin(x);
+    w->operations += 1000;
+}
+
+static void work_memory(LoadWorker* w) {
+    // Metade do buffer é a origem e a outra o destino; 1 MiB por fatia.
+    static const size_t slice = 1u << 20;
+    size_t half = w->bytes / 2;
+    size_t offset = (size_t) (w->operations * slice) % (half - slice + 1);
+    memcpy(w->buffer + half + offset, w->buffer + offset, slice);
+    w->operations++;
+}
+
+static void work_cache(LoadWorker* w) {
+    uint64_t state = w->operations * 2654435761ULL + (uint64_t) w->index + 1;
+    size_t lines = w->bytes / CACHE_LINE;
+    for (int i = 0; i < 4096; i++) {
+        w->buffer[(xorshift64(&state) % lines) * CACHE_LINE]++;
+    }
+    w->operations += 4096;
+}
+
+static void work_pagefault(LoadWorker* w) {
+    // Mapeia uma região nova, toca cada página (uma falta por página) e desfaz.
+    size_t region = w->bytes;
+    long page = sysconf(_SC_PAGESIZE);
+    unsigned char* p = mmap(NULL, region, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) return;
+    for (size_t off = 0; off < region; off += (size_t) page) {
+        p[off] = 1;
+        w->operations++;
+    }
+    munmap(p, region);
+}
+
+static void work_syscall(LoadWorker* w) {
+    for (int i = 0; i < 256; i++) {
+        syscall(SYS_getppid); // Chamada real, sem o atalho do vDSO
+    }
+    w->operations += 256;
+}
+
+static void work_disk(LoadWorker* w) {
+    static unsigned char chunk[DISK_CHUNK_BYTES];
+    // O deslocamento avança também nas falhas, para não insistir no mesmo bloco.
+    off_t offset = (off_t) (((w->operations + w->errors) * DISK_CHUNK_BYTES) % w->bytes);
+    if (pwrite(w->fd, chunk, sizeof(chunk), offset) == (ssize_t) sizeof(chunk) && fdatasync(w->fd) == 0) {
+        w->operations++; // Em blocos; convertido para MiB no relatório
+    } else {
+        w->errors++; // Escrita curta, erro de E/S ou disco cheio: fora da vazão
+    }
+}
+
+static void (*const work_fns[NUM_LOAD_PROFILES])(LoadWorker*) = {
+    [LOAD_CPU] = work_cpu,
+    [LOAD_MEMORY] = work_memory,
+    [LOAD_CACHE] = work_cache,
+    [LOAD_PAGEFAULT] = work_pagefault,
+    [LOAD_SYSCALL] = work_syscall,
+    [LOAD_DISK] = work_disk,
+};
+
+// Laço de uma thread de carga: em cada janela trabalha duty * janela e dorme
+// até a janela seguinte (instantes absolutos, como em periodic.c). Pausada, a
+// thread dorme janelas inteiras.
+static void* load_thread(void* arg) {
+    LoadWorker* w = (LoadWorker*) arg;
+    const LoadConfig* config = w->config;
+    void (*work)(LoadWorker*) = work_fns[config->profile];
+
+    // Intensidade em núcleos: a thread i fica na CPU i (em rodízio).
+    long n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n_cpus > 1) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(w->index % n_cpus, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+
+    uint64_t window_ns = (uint64_t) config->window_ms * 1000000ULL;
+    uint64_t active_ns = (uint64_t) (config->duty * window_ns);
+    uint64_t window_start = now_ns();
+    while (*w->running) {
+        if (!*w->paused) {
+            uint64_t now;
+            while ((now = now_ns()) - window_start < active_ns && *w->running && !*w->paused) {
+                work(w);
+            }
+            w->active_ns += now - window_start;
+        }
+        window_start += window_ns;
+        if (config->duty < 1.0 || *w->paused) {
+            struct timespec next = { (time_t) (window_start / NSEC_PER_SEC), (long) (window_start % NSEC_PER_SEC) };
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR) {
+            }
+        } else {
+            window_start = now_ns();
+        }
+    }
+    return NULL;
+}
+
+// Prepara os recursos de uma thread conforme o perfil.
+static int init_worker(LoadWorker* w, int index, LoadGenerator* gen) {
+    const LoadConfig* config = &gen->config;
+    w->index = index;
+    w->config = config;
+    w->running = &gen->running;
+    w->paused = &gen->paused;
+    w->buffer = NULL;
+    w->fd = -1;
+    w->operations = 0;
+    w->errors = 0;
+    w->active_ns = 0;
+    w->bytes = config->bytes ? config->bytes : default_bytes(config->profile);
+
+    if (config->profile == LOAD_MEMORY || config->profile == LOAD_CACHE) {
+        if (config->profile == LOAD_MEMORY && w->bytes < (4u << 20)) w->bytes = 4u << 20;
+        if (w->bytes < CACHE_LINE) w->bytes = CACHE_LINE;
+        w->buffer = malloc(w->bytes);
+        if (w->buffer == NULL) return -1;
+        memset(w->buffer, 1, w->bytes); // Já residente: a carga mede acesso, não falta de página
+    } else if (config->profile == LOAD_DISK) {
+        char path[256];
+        if (w->bytes < DISK_CHUNK_BYTES) w->bytes = DISK_CHUNK_BYTES;
+        snprintf(path, sizeof(path), "%s/carga_disco_XXXXXX", config->dir);
+        w->fd = mkstemp(path);
+        if (w->fd < 0) {
+            perror("Erro ao criar o arquivo da carga de disco");
+            return -1;
+        }
+        unlink(path); // Some ao fechar
+    }
+    return 0;
+}
+
+// Implementação da criação.
+LoadGenerator* create_load_generator(const LoadConfig* config) {
+    LoadGenerator* gen = malloc(sizeof(LoadGenerator));
+    if (gen == NULL) return NULL;
+    gen->config = *config;
+    gen->running = 1;
+    gen->paused = 0;
+    gen->n_workers = 0;
+    gen->elapsed_s = 0.0;
+    gen->tids = malloc(config->threads * sizeof(pthread_t));
+    gen->workers = calloc(config->threads, sizeof(LoadWorker));
+    if (gen->tids == NULL || gen->workers == NULL) {
+        free_load_generator(gen);
+        return NULL;
+    }
+    for (int i = 0; i < config->threads; i++) {
+        if (init_worker(&gen->workers[i], i, gen) != 0) {
+            gen->n_workers = i + 1; // Libera também os recursos parciais deste
+            gen->running = 0;
+            free_load_generator(gen);
+            return NULL;
+        }
+    }
+
+    // A carga roda em SCHED_OTHER: representa a interferência do sistema de propósito geral.
+    clock_gettime(CLOCK_MONOTONIC, &gen->started);
+    for (int i = 0; i < config->threads; i++) {
+        if (pthread_create(&gen->tids[i], NULL, load_thread, &gen->workers[i]) != 0) break;
+        gen->n_workers = i + 1;
+    }
+    return gen;
+}
+
+// Implementação da pausa.
+void load_set_paused(LoadGenerator* gen, int paused) {
+    gen->paused = paused;
+}
+
+// Implementação da parada.
+void load_stop(LoadGenerator* gen) {
+    if (!gen->running) return;
+    gen->running = 0;
+    for (int i = 0; i < gen->n_workers; i++) pthread_join(gen->tids[i], NULL);
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    gen->elapsed_s = (now.tv_sec - gen->started.tv_sec) + (now.tv_nsec - gen->started.tv_nsec) / 1e9;
+}
+
+// Implementação do resumo.
+void load_print_summary(const LoadGenerator* gen) {
+    char description[128];
+    load_config_describe(&gen->config, description, sizeof(description));
+    printf("\n--- Carga de Interferência: %s ---\n", description);
+    uint64_t operations = 0, errors = 0, active_ns = 0;
+    for (int i = 0; i < gen->n_workers; i++) {
+        operations += gen->workers[i].operations;
+        errors += gen->workers[i].errors;
+        active_ns += gen->workers[i].active_ns;
+    }
+    double amount = (double) operations;
+    if (gen->config.profile == LOAD_DISK) amount = amount * DISK_CHUNK_BYTES / (1 << 20);
+    printf("  - Threads: %d\n", gen->n_workers);
+    printf("  - Trabalho: %.0f %s (%.1f por segundo)\n", amount, operation_units[gen->config.profile],
+           gen->elapsed_s > 0 ? amount / gen->elapsed_s : 0.0);
+    if (errors > 0) printf("  - Escritas com erro (fora da vazão): %lu\n", (unsigned long) errors);
+    if (gen->elapsed_s > 0 && gen->n_workers > 0) {
+        printf("  - Fração ativa medida: %.1f%%\n", 100.0 * active_ns / 1e9 / gen->elapsed_s / gen->n_workers);
+    }
+}
+
+// Implementação da liberação.
+void free_load_generator(LoadGenerator* gen) {
+    if (gen == NULL) return;
+    load_stop(gen);
+    for (int i = 0; i < gen->n_workers && gen->workers != NULL; i++) {
+        free(gen->workers[i].buffer);
+        if (gen->workers[i].fd >= 0) close(gen->workers[i].fd);
+    }
+    free(gen->tids);
+    free(gen->workers);
+    free(gen);
+}
@@ -2,442 +2,1318 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdarg.h>
 #include <string.h>
 #include <pthread.h>
 #include <unistd.h>
 #include <time.h>
 #include <math.h>
-#include <sys/select.h> // Para a função select() de input não-bloqueante
 
 // Inclui todos os nossos módulos de código
 #include "robot.h"
 #include "reference.h"
 #include "ref_model.h"
 #include "control.h"
+#include "trajectory.h"
+#include "periodic.h"
+#include "sched_policy.h"
+#include "textwidth.h"
+#include "snapshot.h"
+#include "monitor.h"
+#include "cyclic.h"
+#include "task.h"
+#include "trace.h"
+#include "analysis.h"
+#include "load.h"
+#include "asynclog.h"
+#include "dashboard.h"
+#include "input.h"
+#include "report.h"
+#include "telemetry.h"
 
-#define MAX_SAMPLES 700 // Define o tamanho dos arrays para armazenar as amostras de tempo
+#define SIMULATION_SECONDS 20 // Duração de cada execução
 
 // --- "Monitores": Variáveis Globais Partilhadas e Seus Mutexes ---
-// Estruturas de dados partilhadas entre as threads, cada uma protegida por um mutex.
+// Estruturas de dados partilhadas entre as threads, cada uma protegida por um mutex
+// instrumentado (espera, posse e contenção por tarefa; ver monitor.h).
 RobotState* g_robot_state;
-pthread_mutex_t g_robot_mutex;
+MonitorMutex g_robot_mutex;
 ReferenceTrajectory* g_reference;
-pthread_mutex_t g_reference_mutex;
+MonitorMutex g_reference_mutex;
+ReferenceTable* g_reference_table; // Somente leitura após a inicialização: dispensa mutex
+SplineTrajectory* g_spline;        // Trajetória de waypoints (opcional, --trajetoria)
+ReferenceSource g_reference_source; // Fonte efetivamente usada pelas tarefas
 RefModel* g_ref_model;
-pthread_mutex_t g_ref_model_mutex;
+MonitorMutex g_ref_model_mutex;
 Controller* g_controller;
-pthread_mutex_t g_controller_mutex;
+MonitorMutex g_controller_mutex;
 double g_alpha1 = 2.0, g_alpha2 = 2.0; // Ganhos do controlador, sintonizados para estabilidade
-pthread_mutex_t g_gains_mutex;
+MonitorMutex g_gains_mutex;
 volatile int g_simulation_running = 1; // Flag para controlar a execução das threads
-volatile int g_load_thread_running = 1; // Flag específica para a thread de carga
+struct timespec g_sim_start; // Instante zero da simulação (CLOCK_MONOTONIC)
+const char* g_policy_label = "SCHED_OTHER"; // Política em uso, exibida nos relatórios
+AsyncLogger* g_logger; // Log assíncrono: as tarefas só enfileiram, uma thread grava
+
+// --- Conjunto de Tarefas Periódicas ---
+// Índices das tarefas na tabela g_tasks (definida após o estado dos jobs).
+enum { TASK_ROBOT, TASK_LINEARIZATION, TASK_CONTROL, TASK_REF_MODEL, TASK_UI, TASK_REF_GEN, NUM_TASKS };
+int g_use_edf = 0;               // Modo --edf: cada tarefa migra para SCHED_DEADLINE
+EdfTask g_edf_tasks[NUM_TASKS];  // Estado EDF de cada tarefa (escrito só pela própria thread)
+
+// --- Publicação Sem Bloqueio (modo --lockfree) ---
+// Cada objeto passa a ter um único escritor, que publica um instantâneo num canal
+// seqlock; as demais tarefas leem cópias locais e nunca esperam umas pelas outras.
+//   Robô -> g_robot_channel          Geração Ref. -> g_reference_channel
+//   Modelo Ref. -> g_ref_model_channel   Controle -> g_control_channel (v)
+//   Linearização -> g_linearization_channel (u)
+// Os ganhos vêm sempre pelo canal g_gains_channel, escrito pela thread de
+// entrada (ver Comandos), nos dois modos.
+int g_lockfree = 0;
+RobotChannel g_robot_channel;
+ReferenceChannel g_reference_channel;
+RefModelChannel g_ref_model_channel;
+ControlChannel g_control_channel;
+LinearizationChannel g_linearization_channel;
+GainsChannel g_gains_channel;
+
+// --- Rastreamento de Causa e Efeito ---
+// Cada amostra publicada carrega o carimbo de origem de cada cadeia (trace.h).
+// No modo monitor os carimbos ficam ao lado dos dados, sob o mesmo mutex; no
+// modo --lockfree viajam dentro dos instantâneos.
+//   Referência:    Modelo Ref. amostra r(t) -> y_m -> v -> u -> Robô
+//   Realimentação: Robô calcula y -> v -> u -> Robô
+//   Exibição:      Geração Ref. publica r(t) -> UI
+enum { TRACE_CHAIN_REFERENCE, TRACE_CHAIN_FEEDBACK, TRACE_CHAIN_DISPLAY, NUM_CHAINS };
+TraceStamp g_robot_stamp;     // Protegido por g_robot_mutex
+TraceStamp g_reference_stamp; // Protegido por g_reference_mutex
+TraceStamp g_ref_model_stamp; // Protegido por g_ref_model_mutex
+TraceStamp g_v_stamp;         // Protegido por g_controller_mutex
+TraceStamp g_u_stamp;         // Protegido por g_controller_mutex
+TraceChain g_chains[NUM_CHAINS]; // Cada cadeia é escrita só pela tarefa no fim dela
+
+// --- Estado Privado dos Jobs ---
+// Visões locais usadas no modo --lockfree (preenchidas a partir dos canais).
+typedef struct {
+    RobotState* robot_view;
+    Controller* controller_view;
+} LinearizationJob;
+
+typedef struct {
+    GainsSnapshot gains;          // Cópia dos ganhos para a qual controller_view aponta
+    uint64_t gains_version;       // Versão dos ganhos em uso pelo controlador
+    long gains_updates;           // Versões novas aplicadas
+    RobotState* robot_view;
+    RefModel* ref_model_view;
+    Controller* controller_view;
+} ControlJob;
+
+typedef struct {
+    ReferenceTrajectory* reference; // Referência local, amostrada a cada job
+} RefModelJob;
+
+typedef struct {
+    BinLog* log;                  // Log binário da execução
+    LogStream* log_stream;        // Anel da UI no log assíncrono
+    const char* output_filename;
+    double t;                     // Tempo exibido/gravado (avança um período por job)
+} UiJob;
+
+LinearizationJob g_linearization_job;
+ControlJob g_control_job;
+RefModelJob g_ref_model_job;
+UiJob g_ui_job;
+
+// --- Painel do Terminal ---
+// A UI só publica a amostra num canal seqlock; a thread do painel (dashboard.h)
+// formata e redesenha a tela no seu próprio ritmo, fora das tarefas periódicas.
+typedef struct {
+    double xc, yc, theta, xref, yref, alpha1, alpha2;
+} UiSample;
+
+typedef struct {
+    double t;
+    UiSample sample;
+} UiDisplay;
+
+typedef struct { _Alignas(64) SeqLock lock; UiDisplay value[2]; } UiDisplayChannel;
+UiDisplayChannel g_ui_display_channel;
+Dashboard* g_dashboard;
+void format_dashboard(void* ctx, DashboardFrame* frame);
+
+// --- Telemetria (--telemetria) ---
+// Segmento de memória compartilhada (telemetry.h) para monitores em outro
+// processo: a UI publica estado, referência e ganhos e cada tarefa os seus
+// contadores de tempo, sempre no seu próprio canal seqlock. ./telemetria lê.
+Telemetry* g_telemetry; // NULL sem --telemetria
+
+// --- Comandos ---
+// Uma thread de entrada (input.h) lê o teclado e trata cada linha; nenhuma
+// tarefa periódica lê a entrada nem dorme por causa dela. Os efeitos chegam às
+// tarefas sem bloqueio: ganhos versionados em g_gains_channel (aplicados pela
+// tarefa de controle), pausa no relógio da simulação, períodos pelo runtime
+// (task_request_period) e a carga por load_set_paused.
+typedef struct {
+    uint64_t count; // Comandos tratados
+    double t;       // Instante da simulação do último comando
+    char text[80];  // Resultado do último comando
+} CommandStatus;
+
+typedef struct { _Alignas(64) SeqLock lock; CommandStatus value[2]; } CommandStatusChannel;
+
+// Relógio da simulação: instantes em ns desde g_sim_start, escritos só pela thread de entrada.
+typedef struct {
+    int64_t offset_ns;    // Tempo total já passado em pausa
+    int64_t paused_at_ns; // Início da pausa em curso (0 = em execução)
+} SimClock;
+
+typedef struct { _Alignas(64) SeqLock lock; SimClock value[2]; } SimClockChannel;
+
+typedef struct {
+    LoadGenerator* load;  // NULL se a execução não tem carga
+    int periods_fixed;    // 1 nos modos --ciclico e --edf (tabela ou reserva fixa)
+    GainsSnapshot gains;  // Últimos ganhos publicados
+    SimClock clock;       // Cópia do escritor do relógio
+    long lines;
+    long rejected;
+} CommandContext;
+
+CommandStatusChannel g_command_status_channel;
+SimClockChannel g_sim_clock_channel;
+CommandContext g_commands;
+InputReader* g_input;
+void handle_command(void* ctx, const char* line);
+
+void job_robot(void* state);
+void job_linearization(void* state);
+void job_control(void* state);
+void job_ref_model(void* state);
+void job_reference_generation(void* state);
+void job_ui(void* state);
+void job_ui_degraded(void* state);
+
+// --- Tabela de Tarefas ---
+// Uma linha por tarefa: nome, corpo, estado, período, deadline (0 = período),
+// prioridade (0 = Deadline Monotonic automática), CPU, política de estouro,
+// corpo degradado e mutexes do modo monitor. O mesmo runtime (task.h) executa
+// todas, com threads ou no executivo cíclico. Os integradores (robô e modelo)
+// recuperam todos os passos; para as demais só o dado mais novo importa.
+const TaskDescriptor g_tasks[NUM_TASKS] = {
+    [TASK_ROBOT]         = { "Robô",         job_robot,                NULL,                 0.030, 0, 0, TASK_ANY_CPU, OVERRUN_IMMEDIATE, NULL,            { &g_controller_mutex, &g_robot_mutex } },
+    [TASK_LINEARIZATION] = { "Linearização", job_linearization,        &g_linearization_job, 0.040, 0, 0, TASK_ANY_CPU, OVERRUN_SKIP,      NULL,            { &g_controller_mutex, &g_robot_mutex } },
+    [TASK_CONTROL]       = { "Controle",     job_control,              &g_control_job,       0.050, 0, 0, TASK_ANY_CPU, OVERRUN_SKIP,      NULL,            { &g_controller_mutex, &g_gains_mutex, &g_ref_model_mutex, &g_robot_mutex } },
+    [TASK_REF_MODEL]     = { "Modelo Ref.",  job_ref_model,            &g_ref_model_job,     0.050, 0, 0, TASK_ANY_CPU, OVERRUN_IMMEDIATE, NULL,            { &g_ref_model_mutex } },
+    [TASK_UI]            = { "UI/Log",       job_ui,                   &g_ui_job,            0.100, 0, 0, TASK_ANY_CPU, OVERRUN_DEGRADE,   job_ui_degraded, { &g_gains_mutex, &g_reference_mutex, &g_robot_mutex } },
+    [TASK_REF_GEN]       = { "Geração Ref.", job_reference_generation, NULL,                 0.120, 0, 0, TASK_ANY_CPU, OVERRUN_SKIP,      NULL,            { &g_reference_mutex } },
+};
+TaskRuntime g_task_runtimes[NUM_TASKS];
+
+// --- Sinais Registrados por Tarefa ---
+// Cada tarefa grava as suas saídas no próprio ritmo, num log binário
+// <log>_<sufixo>.bin, pelo mesmo pipeline assíncrono da UI (um anel por tarefa).
+// A primeira coluna é o instante da publicação, em segundos desde g_sim_start.
+// A UI não tem linha aqui: o log dela é o arquivo principal.
+typedef struct {
+    const char* suffix;
+    int n_columns;
+    const char* columns[ASYNC_LOG_MAX_VALUES];
+} SignalLogDescriptor;
+
+// Nomes das tarefas no comando "periodo <tarefa> <ms>".
+const char* const g_task_keys[NUM_TASKS] = {
+    [TASK_ROBOT] = "robo", [TASK_LINEARIZATION] = "linearizacao", [TASK_CONTROL] = "controle",
+    [TASK_REF_MODEL] = "modelo", [TASK_UI] = "ui", [TASK_REF_GEN] = "referencia",
+};
+
+const SignalLogDescriptor g_signal_logs[NUM_TASKS] = {
+    [TASK_ROBOT]         = { "robo",         8, { "t(s)", "Xc(m)", "Yc(m)", "theta(rad)", "v(m/s)", "omega(rad/s)", "Xf(m)", "Yf(m)" } },
+    [TASK_LINEARIZATION] = { "linearizacao", 3, { "t(s)", "u_v(m/s)", "u_omega(rad/s)" } },
+    [TASK_CONTROL]       = { "controle",     3, { "t(s)", "v_x(m/s)", "v_y(m/s)" } },
+    [TASK_REF_MODEL]     = { "modelo",       5, { "t(s)", "ym_x(m)", "ym_y(m)", "dym_x(m/s)", "dym_y(m/s)" } },
+    [TASK_REF_GEN]       = { "referencia",   3, { "t(s)", "Xref(m)", "Yref(m)" } },
+};
+BinLog* g_signal_binlogs[NUM_TASKS];
+LogStream* g_signal_streams[NUM_TASKS];
 
 // --- Protótipos das Funções ---
-void* thread_robot_simulation(void* arg);
-void* thread_linearization(void* arg);
-void* thread_control(void* arg);
-void* thread_ref_model_simulation(void* arg);
-void* thread_reference_generation(void* arg);
-void* thread_ui_and_logging(void* arg);
-void* thread_carga(void* arg);
-void print_computation_stats(const char* task_name, double times_ms[], int count);
-void calculate_and_print_stats(double periods_ms[], int count, double nominal_period_ms);
+void* thread_cyclic_executive(void* arg);
+int init_jobs(const char* output_filename, const char* load_description);
+void finish_ui_job(UiJob* job);
+void free_jobs(void);
+void print_usage(const char* program);
+void init_channels(void);
+void print_channel_stats(void);
+void calculate_and_print_stats(const Histogram* periods_ns, const DeviationHistogram* jitter_ns,
+                               double nominal_period_ms);
+void print_schedulability_analysis(const RmTask* tasks);
+void print_command_summary(void);
+double simulation_time_s(void);
+int simulation_paused(void);
 
 // --- Função Principal ---
 // Orquestra toda a simulação: inicializa, cria as threads, aguarda e limpa os recursos.
 int main(int argc, char *argv[]) {
     int run_with_load = 0;
-    const char* output_filename = "data/simulation_sem_carga.txt";
+    LoadConfig load_config;
+    int use_rt = 0;
+    int use_cyclic = 0;
+    int use_chain = 0;
+    int overrun = -1; // -1 = política de cada descritor
+    int use_telemetry = 0;
+    char output_filename[128];
+    const char* waypoints_filename = NULL;
+    double path_speed = 1.0; // m/s, mesma velocidade tangencial da trajetória padrão
 
-    // 1. Analisa os argumentos da linha de comando para ativar o modo "com carga".
-    if (argc == 2 && strcmp(argv[1], "--carga") == 0) {
-        run_with_load = 1;
-        output_filename = "data/simulation_com_carga.txt";
-        printf("Executando simulação COM CARGA.\n");
-    } else {
-        printf("Executando simulação SEM CARGA.\n");
+    // 1. Analisa os argumentos da linha de comando.
+    load_config_default(&load_config);
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--carga") == 0) {
+            run_with_load = 1;
+        } else if (strcmp(argv[i], "--perfil-carga") == 0 && i + 1 < argc) {
+            if (load_config_parse(argv[++i], &load_config) != 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+            run_with_load = 1;
+        } else if (strcmp(argv[i], "--rt") == 0) {
+            use_rt = 1;
+        } else if (strcmp(argv[i], "--edf") == 0) {
+            g_use_edf = 1;
+        } else if (strcmp(argv[i], "--lockfree") == 0) {
+            g_lockfree = 1;
+        } else if (strcmp(argv[i], "--ciclico") == 0) {
+            use_cyclic = 1;
+        } else if (strcmp(argv[i], "--encadeado") == 0) {
+            use_chain = 1;
+        } else if (strcmp(argv[i], "--estouro") == 0 && i + 1 < argc) {
+            overrun = overrun_policy_parse(argv[++i]);
+            if (overrun < 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--trajetoria") == 0 && i + 1 < argc) {
+            waypoints_filename = argv[++i];
+        } else if (strcmp(argv[i], "--velocidade") == 0 && i + 1 < argc) {
+            path_speed = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--telemetria") == 0) {
+            use_telemetry = 1;
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (use_rt && g_use_edf) {
+        fprintf(stderr, "As opções --rt e --edf são exclusivas.\n");
+        return 1;
+    }
+    if (use_cyclic && g_use_edf) {
+        fprintf(stderr, "O executivo cíclico usa uma única thread: --edf não se aplica.\n");
+        return 1;
+    }
+    if (use_cyclic && use_chain) {
+        fprintf(stderr, "As opções --ciclico e --encadeado são exclusivas.\n");
+        return 1;
+    }
+    // Com uma única thread não há concorrência: os corpos usam o caminho sem mutexes.
+    if (use_cyclic) g_lockfree = 1;
+    if (use_rt) g_policy_label = "SCHED_FIFO/RM";
+    if (g_use_edf) g_policy_label = "SCHED_DEADLINE/EDF";
+
+    // Os sufixos _rt/_edf separam os logs de cada política das execuções padrão.
+    // O log é binário (binlog.h); ./log2csv converte para CSV ou para o texto antigo.
+    const char* load_suffix = run_with_load ? "com_carga" : "sem_carga";
+    const char* mode_suffix = use_cyclic ? "_ciclico" : (use_chain ? "_encadeado" : (g_lockfree ? "_lockfree" : ""));
+    snprintf(output_filename, sizeof(output_filename), "data/simulation_%s%s%s.bin", load_suffix,
+             use_rt ? "_rt" : (g_use_edf ? "_edf" : ""), mode_suffix);
+    printf("Executando simulação %s (%s, %s).\n", run_with_load ? "COM CARGA" : "SEM CARGA", g_policy_label,
+           use_cyclic ? "executivo cíclico" : (g_lockfree ? "canais seqlock" : "monitores"));
+    if (use_chain) printf("Cadeia disparada por eventos: referência -> modelo -> controle -> linearização -> robô.\n");
+    char load_description[128] = "nenhuma";
+    if (run_with_load) {
+        load_config_describe(&load_config, load_description, sizeof(load_description));
+        printf("Carga de interferência: %s.\n", load_description);
     }
 
     // 2. Inicializa todas as estruturas de dados e mutexes.
     g_robot_state = create_robot_state();
     g_reference = create_reference_trajectory();
+    g_reference_table = create_reference_table(REFERENCE_TABLE_STEP, REFERENCE_TABLE_HORIZON);
+    if (g_reference_table == NULL) {
+        fprintf(stderr, "Erro ao pré-calcular a tabela de referência.\n");
+        return 1;
+    }
+    g_reference_source = reference_source_from_table(g_reference_table);
+    if (waypoints_filename != NULL) {
+        // A spline inteira é construída aqui, antes de as tarefas periódicas começarem.
+        g_spline = load_spline_trajectory(waypoints_filename, path_speed);
+        if (g_spline == NULL) return 1;
+        g_reference_source = spline_reference_source(g_spline);
+        printf("Trajetória: %d waypoints, %.2f m, %.2f m/s (%s).\n", g_spline->n_points,
+               g_spline->length, g_spline->speed, g_spline->closed ? "fechada" : "aberta");
+    }
     g_ref_model = create_ref_model(g_alpha1, g_alpha2);
     g_controller = create_controller(&g_alpha1, &g_alpha2);
 
-    pthread_mutex_init(&g_robot_mutex, NULL);
-    pthread_mutex_init(&g_reference_mutex, NULL);
-    pthread_mutex_init(&g_ref_model_mutex, NULL);
-    pthread_mutex_init(&g_controller_mutex, NULL);
-    pthread_mutex_init(&g_gains_mutex, NULL);
+    monitor_init(&g_robot_mutex, "g_robot_mutex");
+    monitor_init(&g_reference_mutex, "g_reference_mutex");
+    monitor_init(&g_ref_model_mutex, "g_ref_model_mutex");
+    monitor_init(&g_controller_mutex, "g_controller_mutex");
+    monitor_init(&g_gains_mutex, "g_gains_mutex");
+    trace_chain_init(&g_chains[TRACE_CHAIN_REFERENCE], "Referência", "Modelo Ref. amostra r(t) -> y_m -> v -> u -> Robô");
+    trace_chain_init(&g_chains[TRACE_CHAIN_FEEDBACK], "Realimentação", "Robô calcula y -> v -> u -> Robô");
+    trace_chain_init(&g_chains[TRACE_CHAIN_DISPLAY], "Exibição", "Geração Ref. publica r(t) -> UI");
+    if (g_lockfree) init_channels();
+    seqlock_init(&g_gains_channel.lock);
+    seqlock_init(&g_sim_clock_channel.lock);
+    seqlock_init(&g_command_status_channel.lock);
+    g_commands.gains = (GainsSnapshot) { g_alpha1, g_alpha2, 0 };
+    g_commands.periods_fixed = use_cyclic || g_use_edf;
+    SEQLOCK_PUBLISH(&g_gains_channel, &g_commands.gains);
+    SEQLOCK_PUBLISH(&g_sim_clock_channel, &g_commands.clock);
+    g_logger = create_async_logger();
+    if (g_logger == NULL || init_jobs(output_filename, load_description) != 0) return 1;
+    seqlock_init(&g_ui_display_channel.lock);
+    g_dashboard = create_dashboard(format_dashboard, NULL, (int) (g_tasks[TASK_UI].period_s * 1000.0));
+    if (g_dashboard == NULL) return 1;
+    g_input = create_input_reader(handle_command, &g_commands);
+    if (g_input == NULL) return 1;
+    if (use_telemetry) {
+        const char* task_names[NUM_TASKS];
+        char description[TELEMETRY_TEXT_LEN];
+        for (int i = 0; i < NUM_TASKS; i++) task_names[i] = g_tasks[i].name;
+        snprintf(description, sizeof(description), "%.40s, %s, carga: %.56s", g_policy_label,
+                 use_cyclic ? "executivo cíclico" : (g_lockfree ? "canais seqlock" : "monitores"), load_description);
+        g_telemetry = create_telemetry(TELEMETRY_DEFAULT_NAME, description, task_names, NUM_TASKS);
+        if (g_telemetry == NULL) return 1;
+        printf("Telemetria em /dev/shm%s (acompanhe com ./telemetria).\n", TELEMETRY_DEFAULT_NAME);
+    }
+
+    // 3. Atribui prioridades Rate Monotonic a partir dos períodos.
+    // Ordenar pelo deadline relativo (Deadline Monotonic) equivale a RM quando D = T;
+    // uma prioridade explícita no descritor prevalece sobre a automática.
+    RmTask tasks[NUM_TASKS];
+    double periods_s[NUM_TASKS];
+    const char* names[NUM_TASKS];
+    for (int i = 0; i < NUM_TASKS; i++) {
+        tasks[i] = (RmTask) { g_tasks[i].name, task_deadline_s(&g_tasks[i]), 0 };
+        periods_s[i] = g_tasks[i].period_s;
+        names[i] = g_tasks[i].name;
+    }
+    int applied[NUM_TASKS];
+    rm_assign_priorities(tasks, NUM_TASKS);
+    for (int i = 0; i < NUM_TASKS; i++) {
+        if (g_tasks[i].priority > 0) tasks[i].priority = g_tasks[i].priority;
+        edf_task_init(&g_edf_tasks[i], g_tasks[i].name, g_tasks[i].period_s);
+        g_edf_tasks[i].deadline_s = task_deadline_s(&g_tasks[i]);
+    }
+    if (use_rt) sched_lock_memory();
 
-    // 3. Cria as threads.
-    pthread_t tid_robot, tid_linear, tid_control, tid_ref_model, tid_ref_gen, tid_ui, tid_carga;
-    
+    // No modo --ciclico a tabela de quadros é gerada a partir dos mesmos períodos.
+    CyclicSchedule* schedule = NULL;
+    if (use_cyclic) {
+        schedule = create_cyclic_schedule(periods_s, NUM_TASKS);
+        if (schedule == NULL) {
+            fprintf(stderr, "Erro ao gerar a tabela do executivo cíclico.\n");
+            return 1;
+        }
+    }
+
+    // 4. Cria as threads (com SCHED_FIFO explícito no modo --rt).
+    pthread_t tids[NUM_TASKS], tid_executive;
+    LoadGenerator* load = NULL;
+    int executive_applied = SCHED_APPLIED_DEFAULT;
+
+    // A escritora do log e o painel ficam em SCHED_OTHER, abaixo de todas as tarefas no modo --rt.
+    if (async_logger_start(g_logger) != 0 || dashboard_start(g_dashboard) != 0) {
+        fprintf(stderr, "Erro ao criar a thread escritora do log ou a do painel.\n");
+        return 1;
+    }
+
+    // Todas as tarefas são liberadas juntas em g_sim_start (instante crítico).
     printf("Iniciando todas as threads...\n");
-    pthread_create(&tid_robot, NULL, thread_robot_simulation, NULL);
-    pthread_create(&tid_linear, NULL, thread_linearization, NULL);
-    pthread_create(&tid_control, NULL, thread_control, NULL);
-    pthread_create(&tid_ref_model, NULL, thread_ref_model_simulation, NULL);
-    pthread_create(&tid_ref_gen, NULL, thread_reference_generation, NULL);
-    pthread_create(&tid_ui, NULL, thread_ui_and_logging, (void*)output_filename);
+    time_t started = time(NULL); // Identifica a execução no relatório exportado
+    clock_gettime(CLOCK_MONOTONIC, &g_sim_start);
+    for (int i = 0; i < NUM_TASKS; i++) {
+        task_runtime_init(&g_task_runtimes[i], &g_tasks[i], i, &g_simulation_running, &g_sim_start);
+        if (g_use_edf) g_task_runtimes[i].edf = &g_edf_tasks[i];
+        if (overrun >= 0) g_task_runtimes[i].overrun = (OverrunPolicy) overrun;
+        if (g_telemetry != NULL) g_task_runtimes[i].telemetry = &g_telemetry->segment->tasks[i];
+    }
+    if (use_chain) {
+        TaskRuntime* chain[] = {
+            &g_task_runtimes[TASK_REF_GEN], &g_task_runtimes[TASK_REF_MODEL], &g_task_runtimes[TASK_CONTROL],
+            &g_task_runtimes[TASK_LINEARIZATION], &g_task_runtimes[TASK_ROBOT],
+        };
+        task_chain(chain, sizeof(chain) / sizeof(chain[0]));
+    }
+    int fallbacks = 0;
+    if (use_cyclic) {
+        // Uma única thread, com a prioridade da tarefa mais frequente.
+        executive_applied = sched_create_thread(&tid_executive, "Executivo cíclico", use_rt, RM_PRIORITY_TOP,
+                                                thread_cyclic_executive, schedule);
+        if (executive_applied < 0) {
+            fprintf(stderr, "Erro ao criar a thread do executivo cíclico.\n");
+            return 1;
+        }
+        if (executive_applied == SCHED_APPLIED_FALLBACK) fallbacks++;
+    }
+    for (int i = 0; i < NUM_TASKS && !use_cyclic; i++) {
+        applied[i] = sched_create_thread(&tids[i], tasks[i].name, use_rt, tasks[i].priority,
+                                         task_thread, &g_task_runtimes[i]);
+        if (applied[i] < 0) {
+            fprintf(stderr, "Erro ao criar a thread %s.\n", tasks[i].name);
+            return 1;
+        }
+        if (applied[i] == SCHED_APPLIED_FALLBACK) fallbacks++;
+    }
+    if (use_rt) {
+        g_policy_label = fallbacks ? "SCHED_OTHER (fallback de SCHED_FIFO/RM)" : "SCHED_FIFO/RM";
+    }
+    if (use_cyclic) {
+        g_policy_label = (use_rt && !fallbacks) ? "Executivo cíclico (SCHED_FIFO)" : "Executivo cíclico (SCHED_OTHER)";
+    }
 
+    // A carga continua em SCHED_OTHER: representa a interferência do sistema de propósito geral.
     if (run_with_load) {
-        pthread_create(&tid_carga, NULL, thread_carga, NULL);
+        load = create_load_generator(&load_config);
+        if (load == NULL) {
+            fprintf(stderr, "Erro ao iniciar a carga de interferência.\n");
+            return 1;
+        }
+    }
+
+    // A entrada começa com tudo em andamento (o comando "carga" precisa do gerador).
+    g_commands.load = load;
+    if (input_reader_start(g_input) != 0) {
+        fprintf(stderr, "Erro ao criar a thread de entrada.\n");
+        return 1;
     }
 
-    // 4. A thread principal espera 20 segundos.
-    printf("Simulação em andamento por 20 segundos...\n");
-    usleep(20 * 1000000);
+    // 5. A thread principal espera SIMULATION_SECONDS segundos.
+    printf("Simulação em andamento por %d segundos...\n", SIMULATION_SECONDS);
+    usleep(SIMULATION_SECONDS * 1000000);
 
-    // 5. Sinaliza o término para as threads.
+    // 6. Sinaliza o término para as threads.
     printf("Finalizando simulação...\n");
     g_simulation_running = 0;
-    g_load_thread_running = 0;
-
-    // 6. Aguarda a finalização de todas as threads (join).
-    // Espera a UI primeiro para evitar que ela limpe a tela sobre as estatísticas.
-    pthread_join(tid_ui, NULL);
-    pthread_join(tid_robot, NULL);
-    pthread_join(tid_linear, NULL);
-    pthread_join(tid_control, NULL);
-    pthread_join(tid_ref_model, NULL);
-    pthread_join(tid_ref_gen, NULL);
-    if (run_with_load) {
-        pthread_join(tid_carga, NULL);
+    for (int i = 0; i < NUM_TASKS; i++) {
+        task_wake(&g_task_runtimes[i]); // Tarefas encadeadas esperam uma notificação
     }
+
+    // 7. Aguarda a finalização de todas as threads (join).
+    // Espera a UI primeiro; o painel para depois das tarefas, antes das estatísticas.
+    if (use_cyclic) {
+        pthread_join(tid_executive, NULL);
+    } else {
+        pthread_join(tids[TASK_UI], NULL);
+        for (int i = 0; i < NUM_TASKS; i++) {
+            if (i != TASK_UI) pthread_join(tids[i], NULL);
+        }
+    }
+    input_reader_stop(g_input);
+    if (load != NULL) load_stop(load);
+    async_logger_stop(g_logger); // Grava o que restou nos anéis antes de fechar o log
+    dashboard_stop(g_dashboard);
     printf("Todas as threads finalizaram.\n");
 
-    // 7. Libera todos os recursos alocados.
+    // Relatórios por tarefa, coletados de forma uniforme pelo runtime.
+    finish_ui_job(&g_ui_job);
+    for (int i = 0; i < NUM_TASKS; i++) {
+        task_print_report(&g_task_runtimes[i]);
+    }
+    task_print_miss_report(g_task_runtimes, NUM_TASKS);
+    if (load != NULL) load_print_summary(load);
+    async_logger_print_stats(g_logger);
+    dashboard_print_stats(g_dashboard);
+    print_command_summary();
+    trace_print_chains(g_chains, NUM_CHAINS);
+
+    // 8. Resume a política de escalonamento usada em cada tarefa.
+    printf("\n--- Política de Escalonamento: %s ---\n", g_policy_label);
+    if (use_cyclic) {
+        cyclic_schedule_print(schedule, names);
+        printf("  - Thread do executivo: %s\n", sched_applied_name(executive_applied));
+    } else if (!g_use_edf) {
+        printf("| Tarefa         | Período [ms] | Deadline [ms] | Prioridade RM | Política aplicada          | Mutexes\n");
+        printf("|----------------|--------------|---------------|---------------|----------------------------|--------\n");
+        for (int i = 0; i < NUM_TASKS; i++) {
+            printf("| %-*s | %12.0f | %13.0f | %13d | %-26s |", text_field_width(tasks[i].name, 14), tasks[i].name,
+                   g_tasks[i].period_s * 1000.0, task_deadline_s(&g_tasks[i]) * 1000.0, tasks[i].priority,
+                   sched_applied_name(applied[i]));
+            for (int k = 0; k < TASK_MAX_LOCKS && g_tasks[i].locks[k] != NULL; k++) {
+                printf(" %s", g_tasks[i].locks[k]->name);
+            }
+            printf("\n");
+        }
+    } else {
+        printf("| Tarefa         | Período [ms] | Ci aquec. [ms] | Runtime [ms] | Política aplicada          |\n");
+        printf("|----------------|--------------|----------------|--------------|----------------------------|\n");
+        for (int i = 0; i < NUM_TASKS; i++) {
+            const EdfTask* edf = &g_edf_tasks[i];
+            printf("| %-*s | %12.0f | %14.6f | %12.6f | %-26s |\n", text_field_width(tasks[i].name, 14), tasks[i].name,
+                   edf->period_s * 1000.0, edf->max_ci_s * 1000.0, edf->runtime_s * 1000.0,
+                   sched_applied_name(edf->applied));
+        }
+    }
+
+    // Contenção por (tarefa, mutex): no modo --lockfree nenhum mutex é adquirido.
+    monitor_print_stats();
+    if (g_lockfree) print_channel_stats();
+    char base[128], blocking_filename[160];
+    snprintf(base, sizeof(base), "%.*s", (int) (strlen(output_filename) - strlen(".bin")), output_filename);
+    snprintf(blocking_filename, sizeof(blocking_filename), "%s_bloqueio.csv", base);
+    if (monitor_export_csv(blocking_filename) == 0) {
+        printf("Estatísticas de bloqueio salvas em %s\n", blocking_filename);
+    }
+    print_schedulability_analysis(tasks);
+
+    // Relatório para comparação entre execuções: as métricas acima, sem formatação de terminal.
+    ReportRun run = {
+        started, SIMULATION_SECONDS, output_filename, g_policy_label,
+        use_cyclic ? "executivo cíclico" : (g_lockfree ? "canais seqlock" : "monitores"), g_lockfree, use_chain,
+        load_description, overrun >= 0 ? overrun_policy_name((OverrunPolicy) overrun) : "por tarefa",
+        waypoints_filename != NULL ? waypoints_filename : "tabela",
+    };
+    int priorities[NUM_TASKS];
+    for (int i = 0; i < NUM_TASKS; i++) priorities[i] = tasks[i].priority;
+    if (report_export(base, &run, g_task_runtimes, priorities, NUM_TASKS) == 0) {
+        printf("Relatório de tempos salvo em %s_relatorio.json e %s_relatorio.csv\n", base, base);
+    }
+
+    // Jitter sob a política de tempo real ao lado do da execução padrão com as
+    // mesmas opções (mesmo log, sem o sufixo _rt/_edf), se ela já foi feita.
+    if (use_rt || g_use_edf) {
+        char baseline[128];
+        snprintf(baseline, sizeof(baseline), "data/simulation_%s%s", load_suffix, mode_suffix);
+        if (report_print_jitter_comparison(baseline, use_rt ? "RT" : "EDF", g_task_runtimes, NUM_TASKS) != 0) {
+            printf("  - Sem %s_relatorio.csv: rode ./main com as mesmas opções, sem %s, para comparar o jitter.\n",
+                   baseline, use_rt ? "--rt" : "--edf");
+        }
+    }
+
+    // 9. Libera todos os recursos alocados.
     free_robot_state(g_robot_state);
     free_reference_trajectory(g_reference);
+    free_reference_table(g_reference_table);
+    free_spline_trajectory(g_spline);
     free_ref_model(g_ref_model);
     free_controller(g_controller);
+    free_jobs();
+    free_cyclic_schedule(schedule);
+    free_load_generator(load);
+    free_async_logger(g_logger);
+    free_dashboard(g_dashboard);
+    free_input_reader(g_input);
+    free_telemetry(g_telemetry);
 
-    pthread_mutex_destroy(&g_robot_mutex);
-    pthread_mutex_destroy(&g_reference_mutex);
-    pthread_mutex_destroy(&g_ref_model_mutex);
-    pthread_mutex_destroy(&g_controller_mutex);
-    pthread_mutex_destroy(&g_gains_mutex);
+    monitor_destroy(&g_robot_mutex);
+    monitor_destroy(&g_reference_mutex);
+    monitor_destroy(&g_ref_model_mutex);
+    monitor_destroy(&g_controller_mutex);
+    monitor_destroy(&g_gains_mutex);
 
     printf("Simulação concluída com sucesso.\n");
     return 0;
 }
 
 
-// --- Funções das Threads ---
+// --- Corpos dos Jobs ---
+// Cada tarefa periódica é um corpo de job executado uma vez por ativação. As
+// threads periódicas e o executivo cíclico chamam os mesmos corpos; o estado
+// privado de cada tarefa fica na sua struct de job (ver init_jobs()).
 
-// Thread para gerar carga de CPU no cenário de teste.
-void* thread_carga(void* arg) {
-    (void)arg;
-    printf("Thread de Carga iniciada.\n");
-    volatile double x = 0.0;
-    while (g_load_thread_running) {
-        x = sin(x); // Operação computacional intensiva para ocupar um núcleo de CPU.
-    }
-    printf("Thread de Carga finalizada.\n");
-    return NULL;
+// Enfileira as saídas de um job no log de sinais da tarefa, com o instante atual.
+// Em pausa nada é gravado: o tempo está parado e as saídas não mudam.
+static void log_signals(int task, const double* values, int n_values) {
+    if (simulation_paused()) return;
+    double record[ASYNC_LOG_MAX_VALUES];
+    record[0] = simulation_time_s();
+    memcpy(&record[1], values, n_values * sizeof(double));
+    async_log_push(g_signal_streams[task], record, n_values + 1);
 }
 
-// Tarefa (a), Período: 30ms. Simula a física do robô.
-void* thread_robot_simulation(void* arg) {
-    (void)arg;
-    const double period_s = 0.030;
-    static double computation_times_ms[MAX_SAMPLES];
-    static int sample_count = 0;
-    struct timespec start_time, end_time;
+// Fim das cadeias de controle: o comando u(t) é aplicado ao robô agora.
+static void observe_actuation(const TraceStamp* u_stamp) {
+    uint64_t now = trace_now_ns();
+    trace_observe(&g_chains[TRACE_CHAIN_REFERENCE], u_stamp->origin_ns[TRACE_CHAIN_REFERENCE], now);
+    trace_observe(&g_chains[TRACE_CHAIN_FEEDBACK], u_stamp->origin_ns[TRACE_CHAIN_FEEDBACK], now);
+}
 
-    while(g_simulation_running) {
-        clock_gettime(CLOCK_MONOTONIC, &start_time);
-        
-        pthread_mutex_lock(&g_controller_mutex);
-        pthread_mutex_lock(&g_robot_mutex);
+// Colunas do log do robô: estado x, entrada u e saída y.
+static void robot_signals(const RobotState* robot, double* signals) {
+    signals[0] = robot->x->data[0][0];
+    signals[1] = robot->x->data[1][0];
+    signals[2] = robot->x->data[2][0];
+    signals[3] = robot->u->data[0][0];
+    signals[4] = robot->u->data[1][0];
+    signals[5] = robot->y->data[0][0];
+    signals[6] = robot->y->data[1][0];
+}
+
+// Tarefa (a): simula a física do robô.
+void job_robot(void* state) {
+    (void)state;
+    if (simulation_paused()) return; // Planta congelada
+    const double dt = task_period_s(&g_task_runtimes[TASK_ROBOT]);
+    double signals[7];
+    if (g_lockfree) {
+        // Único escritor do estado: lê u(t) do canal e publica o novo estado.
+        LinearizationSnapshot lin;
+        RobotSnapshot snap;
+        SEQLOCK_SNAPSHOT(&g_linearization_channel, &lin);
+        g_robot_state->u->data[0][0] = lin.u[0];
+        g_robot_state->u->data[1][0] = lin.u[1];
+        observe_actuation(&lin.stamp);
+        update_state(g_robot_state, dt);
+        calculate_output_y(g_robot_state);
+        robot_to_snapshot(g_robot_state, &snap);
+        trace_stamp_clear(&snap.stamp);
+        snap.stamp.origin_ns[TRACE_CHAIN_FEEDBACK] = trace_now_ns();
+        SEQLOCK_PUBLISH(&g_robot_channel, &snap);
+        robot_signals(g_robot_state, signals);
+    } else {
+        monitor_lock(&g_controller_mutex);
+        monitor_lock(&g_robot_mutex);
 
         // Copia o comando u(t) e atualiza o estado do robô.
         g_robot_state->u->data[0][0] = g_controller->u_control->data[0][0];
         g_robot_state->u->data[1][0] = g_controller->u_control->data[1][0];
-        update_state(g_robot_state, period_s);
+        observe_actuation(&g_u_stamp);
+        update_state(g_robot_state, dt);
         calculate_output_y(g_robot_state);
+        g_robot_stamp.origin_ns[TRACE_CHAIN_FEEDBACK] = trace_now_ns();
+        robot_signals(g_robot_state, signals);
 
-        pthread_mutex_unlock(&g_robot_mutex);
-        pthread_mutex_unlock(&g_controller_mutex);
-        
-        clock_gettime(CLOCK_MONOTONIC, &end_time);
-        double elapsed_ms = (end_time.tv_sec - start_time.tv_sec) * 1000.0 + (end_time.tv_nsec - start_time.tv_nsec) / 1000000.0;
-        if (sample_count < MAX_SAMPLES) computation_times_ms[sample_count++] = elapsed_ms;
-
-        usleep(30000);
+        monitor_unlock(&g_robot_mutex);
+        monitor_unlock(&g_controller_mutex);
     }
-    print_computation_stats("Thread Robô (30ms)", &computation_times_ms[1], sample_count - 1);
-    return NULL;
+    log_signals(TASK_ROBOT, signals, 7);
 }
 
-// Tarefa (b), Período: 40ms. Calcula a linearização por realimentação.
-void* thread_linearization(void* arg) {
-    (void)arg;
-    static double computation_times_ms[MAX_SAMPLES];
-    static int sample_count = 0;
-    struct timespec start_time, end_time;
+// Tarefa (b): calcula a linearização por realimentação.
+void job_linearization(void* state) {
+    LinearizationJob* job = (LinearizationJob*) state;
+    if (g_lockfree) {
+        RobotSnapshot robot;
+        ControlSnapshot control;
+        LinearizationSnapshot lin;
+        SEQLOCK_SNAPSHOT(&g_robot_channel, &robot);
+        SEQLOCK_SNAPSHOT(&g_control_channel, &control);
+        robot_from_snapshot(job->robot_view, &robot);
+        job->controller_view->v_control->data[0][0] = control.v[0];
+        job->controller_view->v_control->data[1][0] = control.v[1];
 
-    while(g_simulation_running) {
-        clock_gettime(CLOCK_MONOTONIC, &start_time);
-        
-        pthread_mutex_lock(&g_controller_mutex);
-        pthread_mutex_lock(&g_robot_mutex);
+        calculate_linearization_u(job->controller_view, job->robot_view);
+
+        lin.u[0] = job->controller_view->u_control->data[0][0];
+        lin.u[1] = job->controller_view->u_control->data[1][0];
+        lin.stamp = control.stamp; // u herda as origens de v
+        SEQLOCK_PUBLISH(&g_linearization_channel, &lin);
+        log_signals(TASK_LINEARIZATION, lin.u, 2);
+    } else {
+        double u[2];
+        monitor_lock(&g_controller_mutex);
+        monitor_lock(&g_robot_mutex);
 
         // Calcula u(t) = L^-1 * v(t)
         calculate_linearization_u(g_controller, g_robot_state);
+        g_u_stamp = g_v_stamp;
+        u[0] = g_controller->u_control->data[0][0];
+        u[1] = g_controller->u_control->data[1][0];
 
-        pthread_mutex_unlock(&g_robot_mutex);
-        pthread_mutex_unlock(&g_controller_mutex);
-        
-        clock_gettime(CLOCK_MONOTONIC, &end_time);
-        double elapsed_ms = (end_time.tv_sec - start_time.tv_sec) * 1000.0 + (end_time.tv_nsec - start_time.tv_nsec) / 1000000.0;
-        if (sample_count < MAX_SAMPLES) computation_times_ms[sample_count++] = elapsed_ms;
-
-        usleep(40000);
+        monitor_unlock(&g_robot_mutex);
+        monitor_unlock(&g_controller_mutex);
+        log_signals(TASK_LINEARIZATION, u, 2);
     }
-    print_computation_stats("Thread Linearização (40ms)", &computation_times_ms[1], sample_count - 1);
-    return NULL;
 }
 
-// Tarefa (c), Período: 50ms. Calcula o comando de controle v(t).
-void* thread_control(void* arg) {
-    (void)arg;
-    static double computation_times_ms[MAX_SAMPLES];
-    static int sample_count = 0;
-    struct timespec start_time, end_time;
+// Tarefa (c): calcula o comando de controle v(t).
+void job_control(void* state) {
+    ControlJob* job = (ControlJob*) state;
+    if (g_lockfree) {
+        RobotSnapshot robot;
+        RefModelSnapshot ref_model;
+        ControlSnapshot control;
+        SEQLOCK_SNAPSHOT(&g_gains_channel, &job->gains);
+        if (job->gains.version != job->gains_version) {
+            job->gains_version = job->gains.version;
+            job->gains_updates++;
+        }
+        SEQLOCK_SNAPSHOT(&g_ref_model_channel, &ref_model);
+        SEQLOCK_SNAPSHOT(&g_robot_channel, &robot);
+        robot_from_snapshot(job->robot_view, &robot);
+        ref_model_from_snapshot(job->ref_model_view, &ref_model);
 
-    while(g_simulation_running) {
-        clock_gettime(CLOCK_MONOTONIC, &start_time);
-        
-        pthread_mutex_lock(&g_controller_mutex);
-        pthread_mutex_lock(&g_gains_mutex);
-        pthread_mutex_lock(&g_ref_model_mutex);
-        pthread_mutex_lock(&g_robot_mutex);
+        calculate_controller_output_v(job->controller_view, job->robot_view, job->ref_model_view);
+
+        control.v[0] = job->controller_view->v_control->data[0][0];
+        control.v[1] = job->controller_view->v_control->data[1][0];
+        trace_stamp_clear(&control.stamp);
+        control.stamp.origin_ns[TRACE_CHAIN_REFERENCE] = ref_model.stamp.origin_ns[TRACE_CHAIN_REFERENCE];
+        control.stamp.origin_ns[TRACE_CHAIN_FEEDBACK] = robot.stamp.origin_ns[TRACE_CHAIN_FEEDBACK];
+        SEQLOCK_PUBLISH(&g_control_channel, &control);
+        log_signals(TASK_CONTROL, control.v, 2);
+    } else {
+        double v[2];
+        GainsSnapshot gains;
+        SEQLOCK_SNAPSHOT(&g_gains_channel, &gains);
+        monitor_lock(&g_controller_mutex);
+        monitor_lock(&g_gains_mutex);
+        monitor_lock(&g_ref_model_mutex);
+        monitor_lock(&g_robot_mutex);
+
+        // Nova versão dos ganhos: g_controller aponta para g_alpha1/g_alpha2.
+        if (gains.version != job->gains_version) {
+            g_alpha1 = gains.alpha1;
+            g_alpha2 = gains.alpha2;
+            job->gains_version = gains.version;
+            job->gains_updates++;
+        }
 
         // Calcula v(t) = dot_y_m + alpha * (y_m - y)
         calculate_controller_output_v(g_controller, g_robot_state, g_ref_model);
+        g_v_stamp.origin_ns[TRACE_CHAIN_REFERENCE] = g_ref_model_stamp.origin_ns[TRACE_CHAIN_REFERENCE];
+        g_v_stamp.origin_ns[TRACE_CHAIN_FEEDBACK] = g_robot_stamp.origin_ns[TRACE_CHAIN_FEEDBACK];
+        v[0] = g_controller->v_control->data[0][0];
+        v[1] = g_controller->v_control->data[1][0];
 
-        pthread_mutex_unlock(&g_robot_mutex);
-        pthread_mutex_unlock(&g_ref_model_mutex);
-        pthread_mutex_unlock(&g_gains_mutex);
-        pthread_mutex_unlock(&g_controller_mutex);
-        
-        clock_gettime(CLOCK_MONOTONIC, &end_time);
-        double elapsed_ms = (end_time.tv_sec - start_time.tv_sec) * 1000.0 + (end_time.tv_nsec - start_time.tv_nsec) / 1000000.0;
-        if (sample_count < MAX_SAMPLES) computation_times_ms[sample_count++] = elapsed_ms;
-
-        usleep(50000);
+        monitor_unlock(&g_robot_mutex);
+        monitor_unlock(&g_ref_model_mutex);
+        monitor_unlock(&g_gains_mutex);
+        monitor_unlock(&g_controller_mutex);
+        log_signals(TASK_CONTROL, v, 2);
     }
-    print_computation_stats("Thread de Controle (50ms)", &computation_times_ms[1], sample_count - 1);
-    return NULL;
 }
 
-// Tarefas (d) e (e), Período: 50ms. Simula o modelo de referência.
-void* thread_ref_model_simulation(void* arg) {
-    (void)arg;
-    const double period_s = 0.050;
-    static double computation_times_ms[MAX_SAMPLES];
-    static int sample_count = 0;
-    struct timespec start_time, end_time;
+// Tarefas (d) e (e): simula o modelo de referência. A referência local é
+// amostrada da fonte no ritmo desta tarefa, sem esperar pelo produtor de 120ms.
+void job_ref_model(void* state) {
+    RefModelJob* job = (RefModelJob*) state;
+    if (simulation_paused()) return;
+    const double dt = task_period_s(&g_task_runtimes[TASK_REF_MODEL]);
+    uint64_t sampled_ns = trace_now_ns(); // Origem da cadeia de referência
+    reference_source_fill(&g_reference_source, job->reference, simulation_time_s());
 
-    while(g_simulation_running) {
-        clock_gettime(CLOCK_MONOTONIC, &start_time);
-        
-        pthread_mutex_lock(&g_reference_mutex);
-        pthread_mutex_lock(&g_ref_model_mutex);
+    if (g_lockfree) {
+        // Único escritor do modelo: atualiza sem lock e publica o instantâneo.
+        RefModelSnapshot snap;
+        update_ref_model(g_ref_model, job->reference, dt);
+        ref_model_to_snapshot(g_ref_model, &snap);
+        trace_stamp_clear(&snap.stamp);
+        snap.stamp.origin_ns[TRACE_CHAIN_REFERENCE] = sampled_ns;
+        SEQLOCK_PUBLISH(&g_ref_model_channel, &snap);
+    } else {
+        monitor_lock(&g_ref_model_mutex);
 
         // Calcula o próximo estado do modelo de referência.
-        update_ref_model(g_ref_model, g_reference, period_s);
-
-        pthread_mutex_unlock(&g_ref_model_mutex);
-        pthread_mutex_unlock(&g_reference_mutex);
-        
-        clock_gettime(CLOCK_MONOTONIC, &end_time);
-        double elapsed_ms = (end_time.tv_sec - start_time.tv_sec) * 1000.0 + (end_time.tv_nsec - start_time.tv_nsec) / 1000000.0;
-        if (sample_count < MAX_SAMPLES) computation_times_ms[sample_count++] = elapsed_ms;
-        
-        usleep(50000);
-    }
-    print_computation_stats("Thread Modelo Ref. (50ms)", &computation_times_ms[1], sample_count - 1);
-    return NULL;
+        update_ref_model(g_ref_model, job->reference, dt);
+        g_ref_model_stamp.origin_ns[TRACE_CHAIN_REFERENCE] = sampled_ns;
+
+        monitor_unlock(&g_ref_model_mutex);
+    }
+
+    // Esta tarefa é a única escritora do modelo: a leitura fora do mutex é segura.
+    const double signals[] = { g_ref_model->y_m->data[0][0], g_ref_model->y_m->data[1][0],
+                               g_ref_model->dot_y_m->data[0][0], g_ref_model->dot_y_m->data[1][0] };
+    log_signals(TASK_REF_MODEL, signals, 4);
 }
 
-// Tarefa (f), Período: 120ms. Gera a trajetória de referência.
-void* thread_reference_generation(void* arg) {
-    (void)arg;
-    double t = 0.0;
-    const double period_s = 0.120;
-    static double computation_times_ms[MAX_SAMPLES];
-    static int sample_count = 0;
-    struct timespec start_time, end_time;
+// Tarefa (f): publica a referência tabelada no instante atual (usada pela UI/log).
+void job_reference_generation(void* state) {
+    (void)state;
+    if (g_lockfree) {
+        ReferenceSnapshot snap;
+        reference_source_fill(&g_reference_source, g_reference, simulation_time_s());
+        reference_to_snapshot(g_reference, &snap);
+        trace_stamp_clear(&snap.stamp);
+        snap.stamp.origin_ns[TRACE_CHAIN_DISPLAY] = trace_now_ns();
+        SEQLOCK_PUBLISH(&g_reference_channel, &snap);
+    } else {
+        monitor_lock(&g_reference_mutex);
+        reference_source_fill(&g_reference_source, g_reference, simulation_time_s());
+        g_reference_stamp.origin_ns[TRACE_CHAIN_DISPLAY] = trace_now_ns();
+        monitor_unlock(&g_reference_mutex);
+    }
+    // Única escritora de g_reference: lê fora do mutex.
+    const double signals[] = { g_reference->ref_xy->data[0][0], g_reference->ref_xy->data[1][0] };
+    log_signals(TASK_REF_GEN, signals, 2);
+}
 
-    while(g_simulation_running) {
-        clock_gettime(CLOCK_MONOTONIC, &start_time);
+// Copia o estado compartilhado para a amostra (o período da UI é medido pelo runtime).
+static void ui_read_sample(UiSample* sample) {
+    if (g_lockfree) {
+        RobotSnapshot robot;
+        ReferenceSnapshot reference;
+        GainsSnapshot gains;
+        SEQLOCK_SNAPSHOT(&g_robot_channel, &robot);
+        SEQLOCK_SNAPSHOT(&g_reference_channel, &reference);
+        SEQLOCK_SNAPSHOT(&g_gains_channel, &gains);
+        sample->xc = robot.x[0];
+        sample->yc = robot.x[1];
+        sample->theta = robot.x[2];
+        sample->xref = reference.ref_xy[0];
+        sample->yref = reference.ref_xy[1];
+        sample->alpha1 = gains.alpha1;
+        sample->alpha2 = gains.alpha2;
+        trace_observe(&g_chains[TRACE_CHAIN_DISPLAY], reference.stamp.origin_ns[TRACE_CHAIN_DISPLAY], trace_now_ns());
+    } else {
+        monitor_lock(&g_gains_mutex);
+        monitor_lock(&g_reference_mutex);
+        monitor_lock(&g_robot_mutex);
 
-        pthread_mutex_lock(&g_reference_mutex);
-        calculate_reference(g_reference, t);
-        pthread_mutex_unlock(&g_reference_mutex);
-        
-        clock_gettime(CLOCK_MONOTONIC, &end_time);
-        double elapsed_ms = (end_time.tv_sec - start_time.tv_sec) * 1000.0 + (end_time.tv_nsec - start_time.tv_nsec) / 1000000.0;
-        if (sample_count < MAX_SAMPLES) computation_times_ms[sample_count++] = elapsed_ms;
+        // Copia os dados para variáveis locais para exibição.
+        sample->xc = g_robot_state->x->data[0][0];
+        sample->yc = g_robot_state->x->data[1][0];
+        sample->theta = g_robot_state->x->data[2][0];
+        sample->xref = g_reference->ref_xy->data[0][0];
+        sample->yref = g_reference->ref_xy->data[1][0];
+        sample->alpha1 = g_alpha1;
+        sample->alpha2 = g_alpha2;
+        trace_observe(&g_chains[TRACE_CHAIN_DISPLAY], g_reference_stamp.origin_ns[TRACE_CHAIN_DISPLAY], trace_now_ns());
 
-        t += period_s;
-        usleep(120000);
+        monitor_unlock(&g_robot_mutex);
+        monitor_unlock(&g_reference_mutex);
+        monitor_unlock(&g_gains_mutex);
     }
-    print_computation_stats("Thread Geração Ref. (120ms)", &computation_times_ms[1], sample_count - 1);
-    return NULL;
 }
 
-// Tarefa (g), Período: 100ms. Exibe dados na UI e grava em ficheiro.
-void* thread_ui_and_logging(void* filename_arg) {
-    const char* output_filename = (const char*)filename_arg;
-    FILE* log_file = fopen(output_filename, "w");
-    if (log_file == NULL) {
+// Enfileira a amostra no log assíncrono (a escrita em disco fica com a thread escritora).
+static void ui_log_sample(UiJob* job, const UiSample* sample) {
+    const double values[] = { job->t, sample->xc, sample->yc, sample->theta, sample->xref, sample->yref };
+    async_log_push(job->log_stream, values, sizeof(values) / sizeof(values[0]));
+}
+
+// Publica a amostra na memória compartilhada, se a telemetria está ativa.
+static void ui_publish_telemetry(const UiJob* job, const UiSample* sample, int paused) {
+    if (g_telemetry == NULL) return;
+    GainsSnapshot gains;
+    SEQLOCK_SNAPSHOT(&g_gains_channel, &gains);
+    TelemetryState state = {
+        job->t, { sample->xc, sample->yc, sample->theta }, { sample->xref, sample->yref },
+        { sample->alpha1, sample->alpha2 }, gains.version, (uint64_t) paused,
+    };
+    telemetry_publish_state(g_telemetry, &state);
+}
+
+// Tarefa (g): grava a amostra e publica-a para o painel. O teclado fica com a
+// thread de entrada; em pausa o painel continua atualizado, sem gravar nem
+// avançar o tempo.
+void job_ui(void* state) {
+    UiJob* job = (UiJob*) state;
+    UiSample sample;
+    int paused = simulation_paused();
+    ui_read_sample(&sample);
+    if (!paused) ui_log_sample(job, &sample);
+
+    // O desenho da tela fica com a thread do painel.
+    UiDisplay display = { job->t, sample };
+    SEQLOCK_PUBLISH(&g_ui_display_channel, &display);
+    ui_publish_telemetry(job, &sample, paused);
+
+    if (!paused) job->t += task_period_s(&g_task_runtimes[TASK_UI]);
+}
+
+// Tarefa (g), versão degradada (política de estouro): mantém o log, o tempo e a
+// telemetria, mas não atualiza o painel.
+void job_ui_degraded(void* state) {
+    UiJob* job = (UiJob*) state;
+    UiSample sample;
+    int paused = simulation_paused();
+    ui_read_sample(&sample);
+    ui_publish_telemetry(job, &sample, paused);
+    if (paused) return;
+    ui_log_sample(job, &sample);
+    job->t += task_period_s(&g_task_runtimes[TASK_UI]);
+}
+
+// Monta um quadro do painel a partir da última amostra publicada pela UI
+// (executada pela thread do painel).
+void format_dashboard(void* ctx, DashboardFrame* frame) {
+    (void)ctx;
+    UiDisplay d;
+    CommandStatus status;
+    SEQLOCK_SNAPSHOT(&g_ui_display_channel, &d);
+    SEQLOCK_SNAPSHOT(&g_command_status_channel, &status);
+    char (*row)[DASHBOARD_COLS] = frame->rows;
+    int n = 0;
+    snprintf(row[n++], DASHBOARD_COLS, "--- Simulação Robô Lab 3 ---");
+    snprintf(row[n++], DASHBOARD_COLS, "Tempo: %.2f s%s", d.t, simulation_paused() ? "  [PAUSADA]" : "");
+    n++;
+    snprintf(row[n++], DASHBOARD_COLS, "Estado do Robô:");
+    snprintf(row[n++], DASHBOARD_COLS, "  Xc:    %+6.3f m", d.sample.xc);
+    snprintf(row[n++], DASHBOARD_COLS, "  Yc:    %+6.3f m", d.sample.yc);
+    snprintf(row[n++], DASHBOARD_COLS, "  Theta: %+6.3f rad", d.sample.theta);
+    n++;
+    snprintf(row[n++], DASHBOARD_COLS, "Referência:");
+    snprintf(row[n++], DASHBOARD_COLS, "  X_ref: %+6.3f m", d.sample.xref);
+    snprintf(row[n++], DASHBOARD_COLS, "  Y_ref: %+6.3f m", d.sample.yref);
+    n++;
+    snprintf(row[n++], DASHBOARD_COLS, "Ganhos do Controlador:");
+    snprintf(row[n++], DASHBOARD_COLS, "  alpha1: %.2f", d.sample.alpha1);
+    snprintf(row[n++], DASHBOARD_COLS, "  alpha2: %.2f", d.sample.alpha2);
+    n++;
+    snprintf(row[n++], DASHBOARD_COLS, "Comandos: <a1> <a2> | pausa | continua | periodo <tarefa> <ms> | carga on|off | ajuda");
+    if (status.count > 0) {
+        snprintf(row[n], DASHBOARD_COLS, "*** %.70s (t = %.2f s)", status.text, status.t);
+    }
+    n++;
+    // O número do comando muda a linha a cada Enter: o painel a reescreve e apaga o eco.
+    snprintf(row[n], DASHBOARD_COLS, ">>> Comando %lu: ", (unsigned long) status.count + 1);
+    frame->cursor_row = n;
+    frame->cursor_col = (int) strlen(row[n]);
+    frame->n_rows = n + 1;
+}
+
+// Cria o estado privado de cada job e abre o log. Retorna 0 ou -1 em caso de falha.
+int init_jobs(const char* output_filename, const char* load_description) {
+    if (g_lockfree) {
+        // Visões locais preenchidas a partir dos canais; o controlador local da
+        // tarefa de controle aponta para a cópia dos ganhos lida a cada job.
+        g_linearization_job.robot_view = create_robot_state();
+        g_linearization_job.controller_view = create_controller(&g_alpha1, &g_alpha2);
+        g_control_job.robot_view = create_robot_state();
+        g_control_job.ref_model_view = create_ref_model(g_alpha1, g_alpha2);
+        g_control_job.controller_view = create_controller(&g_control_job.gains.alpha1, &g_control_job.gains.alpha2);
+    }
+    g_ref_model_job.reference = create_reference_trajectory();
+
+    // O cabeçalho registra a carga ativa, para que cada log diga em que condições foi gerado.
+    static const char* const columns[] = { "t(s)", "Xc(m)", "Yc(m)", "theta(rad)", "Xref(m)", "Yref(m)" };
+    char description[BINLOG_TEXT_LEN];
+    snprintf(description, sizeof(description), "carga: %s", load_description);
+    g_ui_job.log = create_binlog(output_filename, description, columns, sizeof(columns) / sizeof(columns[0]));
+    if (g_ui_job.log == NULL) {
         perror("Erro ao criar o ficheiro de log");
-        g_simulation_running = 0;
-        return NULL;
-    }
-    fprintf(log_file, "t(s) Xc(m) Yc(m) theta(rad) Xref(m) Yref(m)\n");
-    double t = 0.0;
-    const double period_s = 0.100;
-    fd_set readfds;
-    struct timeval timeout;
-    struct timespec last_time, current_time;
-    double periods_ms[MAX_SAMPLES];
-    int sample_count = 0;
-    clock_gettime(CLOCK_MONOTONIC, &last_time);
+        return -1;
+    }
+    g_ui_job.log_stream = async_logger_add_binary_stream(g_logger, "UI/Log", g_ui_job.log);
+    if (g_ui_job.log_stream == NULL) return -1;
 
+    // Um log de sinais por tarefa, ao lado do principal: <log>_<sufixo>.bin.
+    int base_len = (int) (strlen(output_filename) - strlen(".bin"));
+    for (int i = 0; i < NUM_TASKS; i++) {
+        const SignalLogDescriptor* desc = &g_signal_logs[i];
+        if (desc->suffix == NULL) continue;
+        char filename[192];
+        snprintf(filename, sizeof(filename), "%.*s_%s.bin", base_len, output_filename, desc->suffix);
+        g_signal_binlogs[i] = create_binlog(filename, description, desc->columns, desc->n_columns);
+        if (g_signal_binlogs[i] == NULL) {
+            perror("Erro ao criar o log de sinais");
+            return -1;
+        }
+        g_signal_streams[i] = async_logger_add_binary_stream(g_logger, g_tasks[i].name, g_signal_binlogs[i]);
+        if (g_signal_streams[i] == NULL) return -1;
+    }
+    g_ui_job.output_filename = output_filename;
+    g_ui_job.t = 0.0;
+    return 0;
+}
+
+// Fecha o log da UI e os de sinais e imprime o jitter de ativação da UI.
+void finish_ui_job(UiJob* job) {
+    free_binlog(job->log); // Grava o índice e o rodapé
+    job->log = NULL;
+    for (int i = 0; i < NUM_TASKS; i++) {
+        free_binlog(g_signal_binlogs[i]);
+        g_signal_binlogs[i] = NULL;
+    }
+    printf("Dados salvos em %s\n", job->output_filename);
+    printf("Sinais de cada tarefa salvos em %.*s_<tarefa>.bin\n",
+           (int) (strlen(job->output_filename) - strlen(".bin")), job->output_filename);
+    // Imprime as estatísticas de jitter apenas para esta tarefa.
+    const TaskRuntime* ui = &g_task_runtimes[TASK_UI];
+    calculate_and_print_stats(&ui->period_ns, &ui->jitter_ns, task_period_s(ui) * 1000.0);
+}
+
+// Libera o estado privado dos jobs.
+void free_jobs(void) {
+    free_robot_state(g_linearization_job.robot_view);
+    free_controller(g_linearization_job.controller_view);
+    free_robot_state(g_control_job.robot_view);
+    free_ref_model(g_control_job.ref_model_view);
+    free_controller(g_control_job.controller_view);
+    free_reference_trajectory(g_ref_model_job.reference);
+    free_binlog(g_ui_job.log);
+    for (int i = 0; i < NUM_TASKS; i++) free_binlog(g_signal_binlogs[i]);
+}
+
+
+// --- Funções das Threads ---
+
+// Executivo cíclico (modo --ciclico): uma única thread percorre a tabela de
+// quadros gerada a partir dos períodos e executa os mesmos jobs, em sequência,
+// sem locks nem trocas de contexto entre as tarefas.
+void* thread_cyclic_executive(void* arg) {
+    const CyclicSchedule* schedule = (const CyclicSchedule*) arg;
+
+    // O quadro e todas as tarefas partem da mesma origem (g_sim_start), então a
+    // latência de liberação de cada tarefa é comparável à do modo com threads.
+    PeriodicTask frame_timer;
+    periodic_init_at(&frame_timer, schedule->minor_frame_ms / 1000.0, &g_sim_start);
+
+    long frame = 0;
     while(g_simulation_running) {
-        // Mede o período/jitter desta thread.
-        clock_gettime(CLOCK_MONOTONIC, &current_time);
-        double elapsed_ms = (current_time.tv_sec - last_time.tv_sec) * 1000.0 + (current_time.tv_nsec - last_time.tv_nsec) / 1000000.0;
-        last_time = current_time;
-        if (sample_count < MAX_SAMPLES) periods_ms[sample_count++] = elapsed_ms;
-        
-        pthread_mutex_lock(&g_gains_mutex);
-        pthread_mutex_lock(&g_reference_mutex);
-        pthread_mutex_lock(&g_robot_mutex);
+        periodic_wait_next(&frame_timer);
+        int f = (int) (frame++ % schedule->n_frames);
 
-        // Copia os dados para variáveis locais para exibição.
-        double xc = g_robot_state->x->data[0][0];
-        double yc = g_robot_state->x->data[1][0];
-        double theta = g_robot_state->x->data[2][0];
-        double xref = g_reference->ref_xy->data[0][0];
-        double yref = g_reference->ref_xy->data[1][0];
-        double alpha1 = g_alpha1;
-        double alpha2 = g_alpha2;
-
-        pthread_mutex_unlock(&g_robot_mutex);
-        pthread_mutex_unlock(&g_reference_mutex);
-        pthread_mutex_unlock(&g_gains_mutex);
-
-        // Imprime os dados no terminal.
-        system("clear");
-        printf("--- Simulação Robô Lab 3 ---\n");
-        printf("Tempo: %.2f s\n\n", t);
-        printf("Estado do Robô:\n");
-        printf("  Xc:    %+6.3f m\n", xc);
-        printf("  Yc:    %+6.3f m\n", yc);
-        printf("  Theta: %+6.3f rad\n\n", theta);
-        printf("Referência:\n");
-        printf("  X_ref: %+6.3f m\n", xref);
-        printf("  Y_ref: %+6.3f m\n\n", yref);
-        printf("Ganhos do Controlador:\n");
-        printf("  alpha1: %.2f\n", alpha1);
-        printf("  alpha2: %.2f\n\n", alpha2);
-        printf(">>> Para alterar, digite novos ganhos (ex: 1.5 2.5) e pressione Enter: \n");
-
-        // Grava os dados no ficheiro de log.
-        fprintf(log_file, "%f %f %f %f %f %f\n", t, xc, yc, theta, xref, yref);
-        fflush(log_file);
-
-        // Lógica de input não-bloqueante.
-        FD_ZERO(&readfds);
-        FD_SET(STDIN_FILENO, &readfds);
-        timeout.tv_sec = 0;
-        timeout.tv_usec = 0;
-
-        if (select(STDIN_FILENO + 1, &readfds, NULL, NULL, &timeout) > 0) {
-            char buffer[100];
-            double new_alpha1, new_alpha2;
-            if (fgets(buffer, sizeof(buffer), stdin) != NULL) {
-                if (sscanf(buffer, "%lf %lf", &new_alpha1, &new_alpha2) == 2) {
-                    pthread_mutex_lock(&g_gains_mutex);
-                    g_alpha1 = new_alpha1;
-                    g_alpha2 = new_alpha2;
-                    pthread_mutex_unlock(&g_gains_mutex);
-                    printf("\n*** Ganhos atualizados para alpha1=%.2f, alpha2=%.2f ***\n", new_alpha1, new_alpha2);
-                    sleep(2);
-                }
-            }
+        for (int k = schedule->frame_offset[f]; k < schedule->frame_offset[f + 1]; k++) {
+            TaskRuntime* rt = &g_task_runtimes[schedule->frame_tasks[k]];
+            periodic_start_job(&rt->timer);
+            task_run_job(rt);
         }
 
-        t += period_s;
-        usleep(100000);
+        // Estouro de quadro: os jobs do quadro terminaram depois do início do seguinte.
+        periodic_job_done(&frame_timer);
     }
-    fclose(log_file);
-    printf("Dados salvos em %s\n", output_filename);
-    // Imprime as estatísticas de jitter apenas para esta thread.
-    calculate_and_print_stats(&periods_ms[1], sample_count - 1, 100.0);
+
+    printf("\n--- Quadros do Executivo Cíclico (%d ms) ---\n", schedule->minor_frame_ms);
+    printf("  - Quadros executados: %ld\n", frame);
+    printf("  - Estouros de quadro: %ld (pior atraso %f ms)\n", frame_timer.deadline_misses, frame_timer.max_lateness_ms);
     return NULL;
 }
 
-// Função para calcular e imprimir estatísticas de tempo de computação.
-void print_computation_stats(const char* task_name, double times_ms[], int count) {
-    if (count <= 0) return;
-    double sum = 0;
-    double min_ms = times_ms[0];
-    double max_ms = times_ms[0];
-    for (int i = 0; i < count; i++) {
-        sum += times_ms[i];
-        if (times_ms[i] < min_ms) min_ms = times_ms[i];
-        if (times_ms[i] > max_ms) max_ms = times_ms[i];
-    }
-    printf("\n--- Análise de Tempo de Computação: %s ---\n", task_name);
-    printf("  - Mínimo: %f ms\n", min_ms);
-    printf("  - Médio:  %f ms\n", sum / count);
-    printf("  - Máximo: %f ms (Este é o seu 'Ci' estimado)\n", max_ms);
+// Mostra as opções de linha de comando.
+void print_usage(const char* program) {
+    fprintf(stderr, "Uso: %s [opções]\n", program);
+    fprintf(stderr, "  --carga               Executa com carga de CPU (1 thread, 100%% do tempo)\n");
+    fprintf(stderr, "  --perfil-carga <p>    Carga configurável: perfil[:threads[:ciclo[:MiB]]]\n");
+    fprintf(stderr, "                        perfis: cpu, memoria, cache, paginas, syscall, disco (ex.: memoria:2:0.5:128)\n");
+    fprintf(stderr, "  --rt                  Prioridades Rate Monotonic com SCHED_FIFO e mlockall\n");
+    fprintf(stderr, "  --edf                 EDF com SCHED_DEADLINE (runtime derivado do Ci medido)\n");
+    fprintf(stderr, "  --lockfree            Publica o estado compartilhado por canais seqlock (sem mutexes)\n");
+    fprintf(stderr, "  --ciclico             Executivo cíclico: uma thread percorre a tabela de quadros (hiperperíodo)\n");
+    fprintf(stderr, "  --encadeado           Cadeia de controle disparada por eventos (o fim de um job acorda o consumidor)\n");
+    fprintf(stderr, "  --estouro <política>  Força a política de estouro de todas as tarefas: imediato, descartar ou degradar\n");
+    fprintf(stderr, "  --trajetoria <arq>    Usa uma spline pelos waypoints do arquivo (\"x y\" por linha)\n");
+    fprintf(stderr, "  --velocidade <m/s>    Velocidade de percurso da trajetória de waypoints (padrão 1.0)\n");
+    fprintf(stderr, "  --telemetria          Publica estado e tempos em memória compartilhada (%s)\n", TELEMETRY_DEFAULT_NAME);
 }
 
-// Função para calcular e imprimir estatísticas de Período e Jitter.
-void calculate_and_print_stats(double periods[], int count, double nominal_period_ms) {
-    if (count <= 0) return;
-    double sum_t = 0, sum_j = 0;
-    double min_t = periods[0], max_t = periods[0];
-    double jitters[count];
-    for (int i = 0; i < count; i++) {
-        double p = periods[i];
-        sum_t += p;
-        if (p < min_t) min_t = p;
-        if (p > max_t) max_t = p;
-        jitters[i] = p - nominal_period_ms;
-    }
-    double mean_t = sum_t / count;
-    double min_j = jitters[0], max_j = jitters[0];
-    for (int i = 0; i < count; i++) {
-        sum_j += jitters[i];
-        if (jitters[i] < min_j) min_j = jitters[i];
-        if (jitters[i] > max_j) max_j = jitters[i];
-    }
-    double mean_j = sum_j / count;
-    double variance_t = 0, variance_j = 0;
-    for (int i = 0; i < count; i++) {
-        variance_t += pow(periods[i] - mean_t, 2);
-        variance_j += pow(jitters[i] - mean_j, 2);
-    }
-    variance_t /= count;
-    variance_j /= count;
+// Análise de escalonabilidade com os parâmetros medidos nesta execução: Ci e Ji
+// de cada tarefa, prioridades Deadline Monotonic e, como Bi, o maior entre o
+// bloqueio observado e o limite por herança de prioridade dos conjuntos de mutexes
+// (ilimitado se algum mutex ficou sem PTHREAD_PRIO_INHERIT; ver monitor_init).
+void print_schedulability_analysis(const RmTask* tasks) {
+    AnalysisTask analysis[NUM_TASKS];
+    AnalysisResult result;
+    int priorities[NUM_TASKS];
+    for (int i = 0; i < NUM_TASKS; i++) priorities[i] = tasks[i].priority;
+    for (int i = 0; i < NUM_TASKS; i++) {
+        const TaskRuntime* rt = &g_task_runtimes[i];
+        double measured_ms = monitor_task_blocking_max_ns(rt->id) / 1e6;
+        int unbounded = 0;
+        double bound_ms = task_blocking_bound_ms(g_task_runtimes, priorities, NUM_TASKS, i, &unbounded);
+        analysis[i] = (AnalysisTask) {
+            g_tasks[i].name, task_max_computation_ms(rt), task_period_s(rt) * 1000.0, rt->timer.deadline_ns / 1e6,
+            priorities[i], fmax(measured_ms, bound_ms), task_max_release_jitter_ms(rt), unbounded, 0.0, 0.0
+        };
+    }
+    if (analysis_run(analysis, NUM_TASKS, &result) != 0) return;
+    analysis_print(analysis, NUM_TASKS, &result);
+    if (result.rta_ok >= 0) {
+        printf("  - Mutexes com herança de prioridade: Bi limitado pela maior posse de uma tarefa menos prioritária.\n");
+    }
+}
+
+// Inicializa os canais seqlock e publica os valores iniciais de cada objeto,
+// para que nenhum leitor veja um instantâneo vazio antes da primeira escrita.
+void init_channels(void) {
+    RobotSnapshot robot;
+    ReferenceSnapshot reference;
+    RefModelSnapshot ref_model;
+    ControlSnapshot control = { { 0.0, 0.0 }, { { 0 } } };
+    LinearizationSnapshot linearization = { { 0.0, 0.0 }, { { 0 } } };
+
+    seqlock_init(&g_robot_channel.lock);
+    seqlock_init(&g_reference_channel.lock);
+    seqlock_init(&g_ref_model_channel.lock);
+    seqlock_init(&g_control_channel.lock);
+    seqlock_init(&g_linearization_channel.lock);
+
+    robot_to_snapshot(g_robot_state, &robot);
+    reference_to_snapshot(g_reference, &reference);
+    ref_model_to_snapshot(g_ref_model, &ref_model);
+    trace_stamp_clear(&robot.stamp); // Estado inicial: ainda sem origem em nenhuma cadeia
+    trace_stamp_clear(&reference.stamp);
+    trace_stamp_clear(&ref_model.stamp);
+    SEQLOCK_PUBLISH(&g_robot_channel, &robot);
+    SEQLOCK_PUBLISH(&g_reference_channel, &reference);
+    SEQLOCK_PUBLISH(&g_ref_model_channel, &ref_model);
+    SEQLOCK_PUBLISH(&g_control_channel, &control);
+    SEQLOCK_PUBLISH(&g_linearization_channel, &linearization);
+}
+
+// Imprime quantas publicações cada canal recebeu e quantas leituras precisaram
+// ser repetidas por colidir com uma escrita (o único custo de sincronização).
+void print_channel_stats(void) {
+    struct { const char* name; SeqLock* lock; } channels[] = {
+        { "Robô",         &g_robot_channel.lock },
+        { "Referência",   &g_reference_channel.lock },
+        { "Modelo Ref.",  &g_ref_model_channel.lock },
+        { "Controle (v)", &g_control_channel.lock },
+        { "Lineariz. (u)", &g_linearization_channel.lock },
+        { "Ganhos",       &g_gains_channel.lock },
+    };
+    printf("\n--- Canais seqlock (tempo de bloqueio: 0) ---\n");
+    printf("| Canal          | Publicações | Leituras repetidas |\n");
+    printf("|----------------|-------------|--------------------|\n");
+    for (size_t i = 0; i < sizeof(channels) / sizeof(channels[0]); i++) {
+        printf("| %-*s | %11lu | %18lu |\n", text_field_width(channels[i].name, 14), channels[i].name,
+               atomic_load(&channels[i].lock->writes), atomic_load(&channels[i].lock->read_retries));
+    }
+}
+
+// Nanossegundos de relógio desde g_sim_start (incluindo as pausas).
+static int64_t elapsed_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t) (now.tv_sec - g_sim_start.tv_sec) * 1000000000LL + (now.tv_nsec - g_sim_start.tv_nsec);
+}
+
+// Tempo decorrido desde o início da simulação, base comum a todas as tarefas.
+// Não avança em pausa (comando "pausa").
+double simulation_time_s(void) {
+    SimClock clock;
+    SEQLOCK_SNAPSHOT(&g_sim_clock_channel, &clock);
+    int64_t now = clock.paused_at_ns > 0 ? clock.paused_at_ns : elapsed_ns();
+    return (now - clock.offset_ns) / 1e9;
+}
+
+// 1 enquanto a simulação está pausada.
+int simulation_paused(void) {
+    SimClock clock;
+    SEQLOCK_SNAPSHOT(&g_sim_clock_channel, &clock);
+    return clock.paused_at_ns > 0;
+}
+
+// Publica o resultado de um comando para o painel (ou o imprime, sem terminal).
+static void command_status(CommandContext* cmd, const char* format, ...) {
+    CommandStatus status;
+    va_list args;
+    va_start(args, format);
+    vsnprintf(status.text, sizeof(status.text), format, args);
+    va_end(args);
+    status.count = (uint64_t) cmd->lines;
+    status.t = simulation_time_s();
+    SEQLOCK_PUBLISH(&g_command_status_channel, &status);
+    if (!g_dashboard->enabled) printf("[comando t=%.2f s] %s\n", status.t, status.text);
+}
+
+// Rejeita o comando, contando-o.
+#define COMMAND_REJECT(cmd, ...) do { (cmd)->rejected++; command_status((cmd), __VA_ARGS__); } while (0)
+
+// Trata uma linha digitada (executada pela thread de entrada, em SCHED_OTHER).
+// Comandos: "<a1> <a2>" ou "ganhos <a1> <a2>", "pausa", "continua",
+// "periodo <tarefa> <ms>", "carga on|off" e "ajuda".
+void handle_command(void* ctx, const char* line) {
+    CommandContext* cmd = (CommandContext*) ctx;
+    char word[32] = "", arg[32] = "";
+    double a1, a2;
+    int n_words = sscanf(line, "%31s %31s", word, arg);
+    if (n_words <= 0) return; // Linha vazia
+    cmd->lines++;
+
+    if (sscanf(line, "%lf %lf", &a1, &a2) == 2 || sscanf(line, "ganhos %lf %lf", &a1, &a2) == 2) {
+        if (!(a1 > 0.0 && a2 > 0.0)) {
+            COMMAND_REJECT(cmd, "Ganhos devem ser positivos");
+            return;
+        }
+        // Um único escritor: a versão só cresce e a tarefa de controle aplica o par inteiro.
+        cmd->gains = (GainsSnapshot) { a1, a2, cmd->gains.version + 1 };
+        SEQLOCK_PUBLISH(&g_gains_channel, &cmd->gains);
+        command_status(cmd, "Ganhos v%lu publicados: alpha1 = %.2f, alpha2 = %.2f",
+                       (unsigned long) cmd->gains.version, a1, a2);
+    } else if (strcmp(word, "pausa") == 0) {
+        if (cmd->clock.paused_at_ns > 0) {
+            COMMAND_REJECT(cmd, "A simulação já está pausada");
+            return;
+        }
+        int64_t now = elapsed_ns();
+        cmd->clock.paused_at_ns = now > 0 ? now : 1;
+        SEQLOCK_PUBLISH(&g_sim_clock_channel, &cmd->clock);
+        command_status(cmd, "Simulação pausada (\"continua\" retoma)");
+    } else if (strcmp(word, "continua") == 0) {
+        if (cmd->clock.paused_at_ns == 0) {
+            COMMAND_REJECT(cmd, "A simulação não está pausada");
+            return;
+        }
+        cmd->clock.offset_ns += elapsed_ns() - cmd->clock.paused_at_ns;
+        cmd->clock.paused_at_ns = 0;
+        SEQLOCK_PUBLISH(&g_sim_clock_channel, &cmd->clock);
+        command_status(cmd, "Simulação retomada (%.2f s em pausa no total)", cmd->clock.offset_ns / 1e9);
+    } else if (strcmp(word, "periodo") == 0) {
+        double ms;
+        int task = -1;
+        for (int i = 0; i < NUM_TASKS; i++) {
+            if (strcmp(arg, g_task_keys[i]) == 0) task = i;
+        }
+        if (task < 0 || sscanf(line, "%*s %*s %lf", &ms) != 1 || ms < 1.0 || ms > 1000.0) {
+            COMMAND_REJECT(cmd, "Uso: periodo <robo|linearizacao|controle|modelo|ui|referencia> <1..1000 ms>");
+        } else if (cmd->periods_fixed) {
+            COMMAND_REJECT(cmd, "Períodos fixos neste modo (tabela cíclica ou reserva EDF)");
+        } else if (task_request_period(&g_task_runtimes[task], ms / 1000.0) != 0) {
+            COMMAND_REJECT(cmd, "%s é disparada pela cadeia: o período vem do produtor", g_tasks[task].name);
+        } else {
+            command_status(cmd, "Período de %s: %.0f ms a partir da próxima liberação", g_tasks[task].name, ms);
+        }
+    } else if (strcmp(word, "carga") == 0) {
+        int on = strcmp(arg, "on") == 0;
+        if (!on && strcmp(arg, "off") != 0) {
+            COMMAND_REJECT(cmd, "Uso: carga on|off");
+        } else if (cmd->load == NULL) {
+            COMMAND_REJECT(cmd, "Execução sem carga (use --carga ou --perfil-carga)");
+        } else {
+            load_set_paused(cmd->load, !on);
+            command_status(cmd, "Carga de interferência %s", on ? "ligada" : "desligada");
+        }
+    } else if (strcmp(word, "ajuda") == 0) {
+        command_status(cmd, "<a1> <a2> | pausa | continua | periodo <tarefa> <ms> | carga on|off");
+    } else {
+        COMMAND_REJECT(cmd, "Comando desconhecido: %s (digite ajuda)", word);
+    }
+}
+
+// Resume os comandos recebidos e o que as tarefas aplicaram.
+void print_command_summary(void) {
+    printf("\n--- Comandos (thread de entrada) ---\n");
+    printf("  - Linhas tratadas: %ld (%ld rejeitadas, %ld cortadas)%s\n", g_commands.lines, g_commands.rejected,
+           g_input->truncated, g_input->eof ? "; entrada encerrada" : "");
+    printf("  - Ganhos: versão %lu publicada, versão %lu em uso pelo controle (%ld troca(s) aplicada(s))\n",
+           (unsigned long) g_commands.gains.version, (unsigned long) g_control_job.gains_version,
+           g_control_job.gains_updates);
+    for (int i = 0; i < NUM_TASKS; i++) {
+        const TaskRuntime* rt = &g_task_runtimes[i];
+        if (rt->period_changes == 0) continue;
+        printf("  - Período de %s: %.0f ms (nominal %.0f ms, %ld troca(s))\n", g_tasks[i].name,
+               task_period_s(rt) * 1000.0, g_tasks[i].period_s * 1000.0, rt->period_changes);
+    }
+    int64_t paused_ns = g_commands.clock.offset_ns;
+    if (g_commands.clock.paused_at_ns > 0) paused_ns += elapsed_ns() - g_commands.clock.paused_at_ns;
+    if (paused_ns > 0) printf("  - Tempo em pausa: %.2f s\n", paused_ns / 1e9);
+}
+
+// Função para calcular e imprimir estatísticas de Período e Jitter, a partir
+// das distribuições acumuladas pelo runtime (memória constante): média e
+// variância exatas (Welford); os percentis vêm do jitter, com T(k) = nominal + J(k).
+void calculate_and_print_stats(const Histogram* periods_ns, const DeviationHistogram* jitter_ns,
+                               double nominal_period_ms) {
+    if (periods_ns->count == 0) return;
+    static const struct { const char* name; double p; } rows[] = {
+        { "Mínimo", 0.0 }, { "p50", 50.0 }, { "p90", 90.0 }, { "p99", 99.0 }, { "p99.9", 99.9 }, { "Máximo", 100.0 },
+    };
+    double mean_t = periods_ns->mean / 1e6;
+    double variance_t = histogram_variance(periods_ns) / 1e12;
     double std_dev_t = sqrt(variance_t);
-    double std_dev_j = sqrt(variance_j);
-    printf("\n--- Análise de Tempo da Tarefa de %.0fms ---\n", nominal_period_ms);
+    printf("\n--- Análise de Tempo da Tarefa de %.0fms [%s] ---\n", nominal_period_ms, g_policy_label);
     printf("| Métrica      | Período T(k) [ms] | Jitter J(k) [ms]  |\n");
     printf("|--------------|-------------------|-------------------|\n");
-    printf("| Média        | %17.6f | %17.6f |\n", mean_t, mean_j);
-    printf("| Variância    | %17.6f | %17.6f |\n", variance_t, variance_j);
-    printf("| Desvio Padrão| %17.6f | %17.6f |\n", std_dev_t, std_dev_j);
-    printf("| Mínimo       | %17.6f | %17.6f |\n", min_t, min_j);
-    printf("| Máximo       | %17.6f | %17.6f |\n", max_t, max_j);
+    printf("| Amostras     | %17lu | %17lu |\n", (unsigned long) periods_ns->count, (unsigned long) periods_ns->count);
+    printf("| Média        | %17.6f | %17.6f |\n", mean_t, mean_t - nominal_period_ms);
+    printf("| Variância    | %17.6f | %17.6f |\n", variance_t, variance_t);
+    printf("| Desvio Padrão| %17.6f | %17.6f |\n", std_dev_t, std_dev_t);
+    for (size_t i = 0; i < sizeof(rows) / sizeof(rows[0]); i++) {
+        double jitter_ms = deviation_percentile(jitter_ns, rows[i].p) / 1e6;
+        printf("| %-*s | %17.6f | %17.6f |\n", text_field_width(rows[i].name, 12), rows[i].name,
+               nominal_period_ms + jitter_ms, jitter_ms);
+    }
     printf("------------------------------------------------------\n");
-}
\ No newline at end of file
+}
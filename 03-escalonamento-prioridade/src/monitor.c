@@ -0,0 +1,191 @@
+#define _DEFAULT_SOURCE // Habilita clock_gettime
+
+#include <time.h>
+#include <string.h>
+#include "monitor.h"
+#include "textwidth.h"
+
+// --- Estado Global da Instrumentação ---
+static const char* s_mutex_names[MONITOR_MAX_MUTEXES];
+static int s_mutex_count = 0;
+static const char* s_task_names[MONITOR_MAX_TASKS];
+static MonitorLockStats s_stats[MONITOR_MAX_TASKS][MONITOR_MAX_MUTEXES];
+static Histogram s_job_blocking_ns[MONITOR_MAX_TASKS]; // Espera total por job (B_i)
+static uint64_t s_job_wait_ns[MONITOR_MAX_TASKS];      // Espera acumulada no job corrente
+
+static _Thread_local int tl_task_id = -1;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+// Implementação da inicialização do mutex.
+int monitor_init(MonitorMutex* m, const char* name) {
+    if (s_mutex_count >= MONITOR_MAX_MUTEXES) return -1;
+    // Sem herança, uma tarefa média pode preemptar indefinidamente a dona do
+    // mutex enquanto uma tarefa prioritária espera: Bi deixa de ter limite.
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    int err = pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+    if (err == 0) err = pthread_mutex_init(&m->mutex, &attr);
+    m->priority_inherit = (err == 0);
+    if (err != 0) {
+        fprintf(stderr, "[monitor] AVISO: %s sem herança de prioridade (%s).\n", name, strerror(err));
+        pthread_mutex_init(&m->mutex, NULL);
+    }
+    pthread_mutexattr_destroy(&attr);
+    m->name = name;
+    m->id = s_mutex_count++;
+    s_mutex_names[m->id] = name;
+    return 0;
+}
+
+// Implementação da destruição.
+void monitor_destroy(MonitorMutex* m) {
+    pthread_mutex_destroy(&m->mutex);
+}
+
+// Implementação do registro da tarefa.
+void monitor_register_task(int task_id, const char* task_name) {
+    if (task_id < 0 || task_id >= MONITOR_MAX_TASKS) return;
+    tl_task_id = task_id;
+    s_task_names[task_id] = task_name;
+    histogram_init(&s_job_blocking_ns[task_id]);
+    s_job_wait_ns[task_id] = 0;
+    for (int i = 0; i < MONITOR_MAX_MUTEXES; i++) {
+        MonitorLockStats* st = &s_stats[task_id][i];
+        st->acquisitions = 0;
+        st->contended = 0;
+        histogram_init(&st->wait_ns);
+        histogram_init(&st->hold_ns);
+    }
+}
+
+// Implementação do lock: o caminho sem contenção custa um trylock e uma leitura
+// de relógio; só o caminho com contenção mede a espera.
+void monitor_lock(MonitorMutex* m) {
+    int task = tl_task_id;
+    if (task < 0) {
+        pthread_mutex_lock(&m->mutex);
+        return;
+    }
+    MonitorLockStats* st = &s_stats[task][m->id];
+    uint64_t wait = 0;
+    if (pthread_mutex_trylock(&m->mutex) != 0) {
+        uint64_t start = now_ns();
+        pthread_mutex_lock(&m->mutex);
+        st->acquired_at_ns = now_ns();
+        wait = st->acquired_at_ns - start;
+        st->contended++;
+    } else {
+        st->acquired_at_ns = now_ns();
+    }
+    st->acquisitions++;
+    histogram_record(&st->wait_ns, wait);
+    s_job_wait_ns[task] += wait;
+}
+
+// Implementação do unlock.
+void monitor_unlock(MonitorMutex* m) {
+    int task = tl_task_id;
+    if (task >= 0) {
+        MonitorLockStats* st = &s_stats[task][m->id];
+        histogram_record(&st->hold_ns, now_ns() - st->acquired_at_ns);
+    }
+    pthread_mutex_unlock(&m->mutex);
+}
+
+// Implementação do fechamento do job.
+void monitor_job_done(void) {
+    int task = tl_task_id;
+    if (task < 0) return;
+    histogram_record(&s_job_blocking_ns[task], s_job_wait_ns[task]);
+    s_job_wait_ns[task] = 0;
+}
+
+// Implementação do relatório por tarefa.
+void monitor_print_task_blocking(int task_id, const char* label) {
+    if (task_id < 0 || task_id >= MONITOR_MAX_TASKS) return;
+    const Histogram* h = &s_job_blocking_ns[task_id];
+    printf("\n--- Bloqueio em Mutexes por Job: %s ---\n", label);
+    if (h->count == 0) {
+        printf("  - Nenhum job registrado.\n");
+        return;
+    }
+    printf("  - Médio:  %.6f ms\n", histogram_mean(h) / 1e6);
+    printf("  - p99:    %.6f ms\n", histogram_percentile(h, 99.0) / 1e6);
+    printf("  - Máximo: %.6f ms (Este é o seu 'Bi' observado)\n", h->max / 1e6);
+}
+
+// Implementação das consultas usadas pela análise de escalonabilidade.
+uint64_t monitor_task_blocking_max_ns(int task_id) {
+    if (task_id < 0 || task_id >= MONITOR_MAX_TASKS) return 0;
+    return s_job_blocking_ns[task_id].count > 0 ? s_job_blocking_ns[task_id].max : 0;
+}
+
+const Histogram* monitor_task_blocking(int task_id) {
+    static const Histogram empty = { .min = UINT64_MAX };
+    if (task_id < 0 || task_id >= MONITOR_MAX_TASKS) return &empty;
+    return &s_job_blocking_ns[task_id];
+}
+
+uint64_t monitor_hold_max_ns(int task_id, const MonitorMutex* m) {
+    if (task_id < 0 || task_id >= MONITOR_MAX_TASKS) return 0;
+    const MonitorLockStats* st = &s_stats[task_id][m->id];
+    return st->acquisitions > 0 ? st->hold_ns.max : 0;
+}
+
+// Implementação do relatório (tarefa x mutex); só lista pares que foram usados.
+void monitor_print_stats(void) {
+    printf("\n--- Contenção nos Monitores (tempos em us) ---\n");
+    printf("| Tarefa         | Mutex              | Aquisições | Contenções | Espera méd. | Espera p99 | Espera máx. | Posse méd. | Posse máx. |\n");
+    printf("|----------------|--------------------|------------|------------|-------------|------------|-------------|------------|------------|\n");
+    int rows = 0;
+    for (int t = 0; t < MONITOR_MAX_TASKS; t++) {
+        if (s_task_names[t] == NULL) continue;
+        for (int m = 0; m < s_mutex_count; m++) {
+            const MonitorLockStats* st = &s_stats[t][m];
+            if (st->acquisitions == 0) continue;
+            printf("| %-*s | %-18s | %10lu | %10lu | %11.3f | %10.3f | %11.3f | %10.3f | %10.3f |\n",
+                   text_field_width(s_task_names[t], 14), s_task_names[t], s_mutex_names[m],
+                   (unsigned long) st->acquisitions, (unsigned long) st->contended, histogram_mean(&st->wait_ns) / 1e3,
+                   histogram_percentile(&st->wait_ns, 99.0) / 1e3, st->wait_ns.max / 1e3,
+                   histogram_mean(&st->hold_ns) / 1e3, st->hold_ns.max / 1e3);
+            rows++;
+        }
+    }
+    if (rows == 0) printf("| (nenhum mutex foi adquirido)                                                                                     |\n");
+}
+
+// Implementação da exportação CSV.
+int monitor_export_csv(const char* filename) {
+    FILE* f = fopen(filename, "w");
+    if (f == NULL) {
+        perror("Erro ao criar o CSV de bloqueio");
+        return -1;
+    }
+    fprintf(f, "tarefa,mutex,aquisicoes,contencoes,espera_media_ns,espera_p50_ns,espera_p99_ns,espera_max_ns,"
+               "posse_media_ns,posse_p99_ns,posse_max_ns\n");
+    for (int t = 0; t < MONITOR_MAX_TASKS; t++) {
+        if (s_task_names[t] == NULL) continue;
+        for (int m = 0; m < s_mutex_count; m++) {
+            const MonitorLockStats* st = &s_stats[t][m];
+            if (st->acquisitions == 0) continue;
+            fprintf(f, "%s,%s,%lu,%lu,%.1f,%lu,%lu,%lu,%.1f,%lu,%lu\n", s_task_names[t], s_mutex_names[m],
+                    (unsigned long) st->acquisitions, (unsigned long) st->contended,
+                    histogram_mean(&st->wait_ns), (unsigned long) histogram_percentile(&st->wait_ns, 50.0),
+                    (unsigned long) histogram_percentile(&st->wait_ns, 99.0), (unsigned long) st->wait_ns.max,
+                    histogram_mean(&st->hold_ns), (unsigned long) histogram_percentile(&st->hold_ns, 99.0),
+                    (unsigned long) st->hold_ns.max);
+        }
+        // Linha agregada da tarefa: bloqueio total por job (B_i).
+        const Histogram* h = &s_job_blocking_ns[t];
+        fprintf(f, "%s,B_i,%lu,,%.1f,%lu,%lu,%lu,,,\n", s_task_names[t], (unsigned long) h->count,
+                histogram_mean(h), (unsigned long) histogram_percentile(h, 50.0),
+                (unsigned long) histogram_percentile(h, 99.0), (unsigned long) h->max);
+    }
+    fclose(f);
+    return 0;
+}
@@ -0,0 +1,106 @@
+#define _DEFAULT_SOURCE // Habilita clock_nanosleep
+
+#include <stdio.h>
+#include <errno.h>
+#include "periodic.h"
+
+#define NSEC_PER_SEC 1000000000L
+
+// Soma nanossegundos a um instante, mantendo tv_nsec normalizado.
+static void timespec_add_ns(struct timespec* ts, long ns) {
+    ts->tv_nsec += ns;
+    while (ts->tv_nsec >= NSEC_PER_SEC) {
+        ts->tv_nsec -= NSEC_PER_SEC;
+        ts->tv_sec++;
+    }
+}
+
+// Diferença (a - b) em nanossegundos, sem passar por ponto flutuante.
+static int64_t timespec_diff_ns(const struct timespec* a, const struct timespec* b) {
+    return (int64_t) (a->tv_sec - b->tv_sec) * NSEC_PER_SEC + (a->tv_nsec - b->tv_nsec);
+}
+
+// Diferença (a - b) em milissegundos.
+static double timespec_diff_ms(const struct timespec* a, const struct timespec* b) {
+    return (a->tv_sec - b->tv_sec) * 1000.0 + (a->tv_nsec - b->tv_nsec) / 1000000.0;
+}
+
+// Implementação da inicialização.
+void periodic_init(PeriodicTask* task, double period_s) {
+    task->period_ns = (long) (period_s * NSEC_PER_SEC + 0.5);
+    task->job_period_ns = task->period_ns;
+    task->next_period_ns = task->period_ns;
+    task->deadline_ns = task->period_ns;
+    task->jobs = 0;
+    task->deadline_misses = 0;
+    task->max_lateness_ms = 0.0;
+    histogram_init(&task->latency_ns);
+    clock_gettime(CLOCK_MONOTONIC, &task->next_release);
+    task->last_release = task->next_release;
+}
+
+// Implementação da inicialização com liberação explícita.
+void periodic_init_at(PeriodicTask* task, double period_s, const struct timespec* first_release) {
+    periodic_init(task, period_s);
+    task->next_release = *first_release;
+    task->last_release = *first_release;
+}
+
+// Implementação da espera pela próxima liberação.
+void periodic_wait_next(PeriodicTask* task) {
+    // Dorme até o instante absoluto; reinicia se for interrompido por sinal.
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &task->next_release, NULL) == EINTR) {
+    }
+    periodic_start_job(task);
+}
+
+// Implementação do início do job: a liberação corrente é next_release.
+void periodic_start_job(PeriodicTask* task) {
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (task->jobs > 0) {
+        int64_t latency_ns = timespec_diff_ns(&start, &task->next_release);
+        histogram_record(&task->latency_ns, latency_ns > 0 ? (uint64_t) latency_ns : 0);
+    }
+
+    task->last_release = task->next_release;
+    task->job_period_ns = task->next_period_ns;
+    timespec_add_ns(&task->next_release, task->period_ns);
+    task->next_period_ns = task->period_ns;
+    task->jobs++;
+}
+
+// Implementação do início de um job liberado por evento.
+void periodic_start_job_at(PeriodicTask* task, const struct timespec* release) {
+    task->next_release = *release;
+    task->next_period_ns = task->period_ns;
+    periodic_start_job(task);
+}
+
+// Implementação do deadline explícito.
+void periodic_set_deadline(PeriodicTask* task, double deadline_s) {
+    task->deadline_ns = (long) (deadline_s * NSEC_PER_SEC + 0.5);
+}
+
+// Implementação da verificação de deadline: o deadline do job corrente é a
+// sua liberação (last_release) + D; com D = T é a próxima liberação.
+double periodic_job_done(PeriodicTask* task) {
+    struct timespec finish, deadline = task->last_release;
+    clock_gettime(CLOCK_MONOTONIC, &finish);
+    timespec_add_ns(&deadline, task->deadline_ns);
+    double lateness_ms = timespec_diff_ms(&finish, &deadline);
+    if (lateness_ms > 0.0) {
+        task->deadline_misses++;
+        if (lateness_ms > task->max_lateness_ms) task->max_lateness_ms = lateness_ms;
+    }
+    return lateness_ms;
+}
+
+// Implementação do relatório de latência de liberação.
+void periodic_print_latency_stats(const char* task_name, const PeriodicTask* task) {
+    if (task->latency_ns.count == 0) return;
+    printf("\n--- Latência de Liberação (liberação -> início): %s ---\n", task_name);
+    printf("  - Jobs:   %ld\n", task->jobs);
+    histogram_print_ms(&task->latency_ns, NULL);
+    printf("  - Perdas de deadline: %ld (pior atraso %f ms)\n", task->deadline_misses, task->max_lateness_ms);
+}
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include "reference.h"
 #include "robot.h" // Inclui para ter acesso a M_PI
+#include "fastmath.h"
 
 // Implementação da alocação de memória.
 ReferenceTrajectory* create_reference_trajectory() {
@@ -25,21 +26,139 @@ void calculate_reference(ReferenceTrajectory* ref, double t) {
 
     // Constante 5/pi usada em ambas as equações.
     const double factor = 5.0 / M_PI;
+    double sin_wt, cos_wt;
+    fast_sincos(0.2 * M_PI * t, &sin_wt, &cos_wt);
 
     // Calcula xref(t) conforme a equação do PDF
-    double xref = factor * cos(0.2 * M_PI * t);
+    double xref = factor * cos_wt;
 
     // Calcula yref(t), que é uma função piecewise
     double yref;
     if (t < 10.0) {
         // Para 0 <= t < 10
-        yref = factor * sin(0.2 * M_PI * t);
+        yref = factor * sin_wt;
     } else {
         // Para t >= 10
-        yref = -factor * sin(0.2 * M_PI * t);
+        yref = -factor * sin_wt;
     }
 
     // Armazena os valores calculados na matriz da estrutura.
     ref->ref_xy->data[0][0] = xref;
     ref->ref_xy->data[1][0] = yref;
-}
\ No newline at end of file
+}
+
+// --- Tabela Pré-calculada ---
+
+// Avalia a forma fechada da referência e das suas derivadas. 'branch' escolhe o
+// ramo de yref (+1 para t < 10, -1 para t >= 10), de modo que a extremidade
+// direita do último intervalo antes de t = 10 use o ramo da esquerda.
+static void reference_analytic(double t, double branch, double pos[2], double vel[2], double acc[2]) {
+    const double factor = 5.0 / M_PI;
+    const double w = 0.2 * M_PI;
+    double sin_wt, cos_wt;
+    fast_sincos(w * t, &sin_wt, &cos_wt);
+
+    pos[0] = factor * cos_wt;
+    vel[0] = -factor * w * sin_wt;
+    acc[0] = -factor * w * w * cos_wt;
+
+    pos[1] = branch * factor * sin_wt;
+    vel[1] = branch * factor * w * cos_wt;
+    acc[1] = -branch * factor * w * w * sin_wt;
+}
+
+// Implementação da construção da tabela.
+ReferenceTable* create_reference_table(double step, double horizon) {
+    if (step <= 0.0 || horizon < 20.0) return NULL;
+
+    ReferenceTable* table = (ReferenceTable*) malloc(sizeof(ReferenceTable));
+    if (table == NULL) return NULL;
+
+    table->step = step;
+    table->inv_step = 1.0 / step;
+    table->n_segments = (int) ceil(horizon / step);
+    table->horizon = table->n_segments * step;
+    table->segments = (ReferenceSegment*) malloc(table->n_segments * sizeof(ReferenceSegment));
+    if (table->segments == NULL) {
+        free(table);
+        return NULL;
+    }
+
+    for (int i = 0; i < table->n_segments; i++) {
+        ReferenceSegment* seg = &table->segments[i];
+        double t0 = i * step;
+        double t1 = (i + 1) * step;
+        // O ramo é definido pelo início do intervalo (com tolerância ao arredondamento de t0).
+        double branch = (t0 < 10.0 - 0.5 * step) ? 1.0 : -1.0;
+        reference_analytic(t0, branch, seg->p0, seg->v0, seg->a0);
+        reference_analytic(t1, branch, seg->p1, seg->v1, seg->a1);
+    }
+    return table;
+}
+
+// Implementação da liberação da tabela.
+void free_reference_table(ReferenceTable* table) {
+    if (table == NULL) return;
+    free(table->segments);
+    free(table);
+}
+
+// Implementação da consulta em O(1).
+void reference_table_lookup(const ReferenceTable* table, double t, ReferenceSample* out) {
+    // 1. Leva t para o trecho tabelado (após 10 s a trajetória tem período de 10 s).
+    if (t < 0.0) t = 0.0;
+    if (t >= table->horizon) t = 10.0 + fmod(t - 10.0, 10.0);
+
+    // 2. Localiza o intervalo por divisão direta (sem busca).
+    int i = (int) (t * table->inv_step);
+    if (i >= table->n_segments) i = table->n_segments - 1;
+    const ReferenceSegment* seg = &table->segments[i];
+    double h = table->step;
+    double u = (t - i * h) * table->inv_step;
+
+    // 3. Bases de Hermite cúbicas e suas derivadas em u.
+    double u2 = u * u, u3 = u2 * u;
+    double h00 = 2 * u3 - 3 * u2 + 1, h10 = u3 - 2 * u2 + u;
+    double h01 = -2 * u3 + 3 * u2,    h11 = u3 - u2;
+    double d00 = 6 * u2 - 6 * u,      d10 = 3 * u2 - 4 * u + 1;
+    double d01 = -6 * u2 + 6 * u,     d11 = 3 * u2 - 2 * u;
+
+    // 4. Posição interpolada com (p, v); velocidade com (v, a); aceleração é a
+    // derivada da curva de velocidade, coerente com ela.
+    for (int k = 0; k < 2; k++) {
+        out->pos[k] = h00 * seg->p0[k] + h10 * h * seg->v0[k] + h01 * seg->p1[k] + h11 * h * seg->v1[k];
+        out->vel[k] = h00 * seg->v0[k] + h10 * h * seg->a0[k] + h01 * seg->v1[k] + h11 * h * seg->a1[k];
+        out->acc[k] = (d00 * seg->v0[k] + d01 * seg->v1[k]) * table->inv_step
+                    + d10 * seg->a0[k] + d11 * seg->a1[k];
+    }
+}
+
+// Implementação do preenchimento da ReferenceTrajectory a partir da tabela.
+void reference_table_fill(const ReferenceTable* table, ReferenceTrajectory* ref, double t) {
+    if (table == NULL || ref == NULL || ref->ref_xy == NULL) return;
+    ReferenceSample sample;
+    reference_table_lookup(table, t, &sample);
+    ref->ref_xy->data[0][0] = sample.pos[0];
+    ref->ref_xy->data[1][0] = sample.pos[1];
+}
+
+// --- Interface ReferenceSource ---
+
+// Adaptador da tabela para a assinatura genérica de amostragem.
+static void table_sample(const void* source, double t, ReferenceSample* out) {
+    reference_table_lookup((const ReferenceTable*) source, t, out);
+}
+
+ReferenceSource reference_source_from_table(const ReferenceTable* table) {
+    ReferenceSource src = { table_sample, table, "trajetória padrão (tabela)" };
+    return src;
+}
+
+// Implementação do preenchimento a partir de uma fonte qualquer.
+void reference_source_fill(const ReferenceSource* src, ReferenceTrajectory* ref, double t) {
+    if (src == NULL || src->sample == NULL || ref == NULL || ref->ref_xy == NULL) return;
+    ReferenceSample sample;
+    src->sample(src->source, t, &sample);
+    ref->ref_xy->data[0][0] = sample.pos[0];
+    ref->ref_xy->data[1][0] = sample.pos[1];
+}
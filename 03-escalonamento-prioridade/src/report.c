@@ -0,0 +1,387 @@
+#define _DEFAULT_SOURCE // Habilita gethostname
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <sys/utsname.h>
+#include "report.h"
+#include "textwidth.h"
+
+// Resumo de uma distribuição em ms, na ordem das colunas do CSV.
+typedef struct {
+    unsigned long count;
+    double mean_ms, stddev_ms, min_ms, p50_ms, p90_ms, p99_ms, p999_ms, max_ms;
+} Summary;
+
+// Distribuições exportadas por tarefa: chave no JSON e prefixo das colunas no CSV.
+enum { DIST_PERIOD, DIST_JITTER, DIST_COMPUTATION, DIST_RESPONSE, DIST_LATENCY, DIST_BLOCKING, DIST_CHAIN, NUM_DISTS };
+static const char* const dist_keys[NUM_DISTS] = {
+    "periodo", "jitter", "computacao", "resposta", "latencia_liberacao", "bloqueio", "resposta_cadeia",
+};
+
+// Identificação da máquina.
+typedef struct {
+    char host[64];
+    struct utsname uts;
+    char cpu_model[128];
+    long n_cpus;
+} HostInfo;
+
+static Summary summarize(const Histogram* hist) {
+    Summary s = { (unsigned long) hist->count, hist->mean / 1e6, histogram_stddev(hist) / 1e6,
+                  histogram_value_at_rank(hist, 0) / 1e6, histogram_percentile(hist, 50.0) / 1e6,
+                  histogram_percentile(hist, 90.0) / 1e6, histogram_percentile(hist, 99.0) / 1e6,
+                  histogram_percentile(hist, 99.9) / 1e6, histogram_percentile(hist, 100.0) / 1e6 };
+    return s;
+}
+
+// Jitter: cada amostra já é o desvio em relação ao período que agendou aquela
+// liberação (PeriodicTask.job_period_ns), então média, desvio e percentis vêm
+// só do histograma com sinal, sem depender do período final.
+static Summary summarize_jitter(const TaskRuntime* rt) {
+    const DeviationHistogram* jitter = &rt->jitter_ns;
+    Summary s = { (unsigned long) (jitter->below.count + jitter->above.count), deviation_mean(jitter) / 1e6,
+                  deviation_stddev(jitter) / 1e6, deviation_percentile(jitter, 0.0) / 1e6,
+                  deviation_percentile(jitter, 50.0) / 1e6, deviation_percentile(jitter, 90.0) / 1e6,
+                  deviation_percentile(jitter, 99.0) / 1e6, deviation_percentile(jitter, 99.9) / 1e6,
+                  deviation_percentile(jitter, 100.0) / 1e6 };
+    return s;
+}
+
+// Período: média, desvio e contagem do histograma (Welford, exatos); mínimo,
+// percentis e máximo como nominal + J(k), como na tabela do terminal. Lidos
+// direto das faixas do período, seriam limites de faixa, não medições. Se o
+// período mudou durante a execução ("periodo"), não há um nominal único: os
+// percentis vêm das faixas do próprio histograma (trocas_de_periodo > 0 no
+// relatório marca o caso).
+static Summary summarize_period(const TaskRuntime* rt) {
+    if (rt->period_changes > 0) return summarize(&rt->period_ns);
+    const DeviationHistogram* jitter = &rt->jitter_ns;
+    double nominal_ms = rt->timer.period_ns / 1e6;
+    Summary s = { (unsigned long) rt->period_ns.count, rt->period_ns.mean / 1e6,
+                  histogram_stddev(&rt->period_ns) / 1e6, nominal_ms + deviation_percentile(jitter, 0.0) / 1e6,
+                  nominal_ms + deviation_percentile(jitter, 50.0) / 1e6,
+                  nominal_ms + deviation_percentile(jitter, 90.0) / 1e6,
+                  nominal_ms + deviation_percentile(jitter, 99.0) / 1e6,
+                  nominal_ms + deviation_percentile(jitter, 99.9) / 1e6,
+                  nominal_ms + deviation_percentile(jitter, 100.0) / 1e6 };
+    return s;
+}
+
+static void summarize_task(const TaskRuntime* rt, Summary* dists) {
+    dists[DIST_PERIOD] = summarize_period(rt);
+    dists[DIST_JITTER] = summarize_jitter(rt);
+    dists[DIST_COMPUTATION] = summarize(&rt->computation_ns);
+    dists[DIST_RESPONSE] = summarize(&rt->response_ns);
+    dists[DIST_LATENCY] = summarize(&rt->timer.latency_ns);
+    dists[DIST_BLOCKING] = summarize(monitor_task_blocking(rt->id));
+    dists[DIST_CHAIN] = summarize(&rt->chain_response_ns);
+}
+
+// Primeiro "model name" de /proc/cpuinfo (ou "desconhecido").
+static void read_cpu_model(char* model, size_t size) {
+    snprintf(model, size, "desconhecido");
+    FILE* f = fopen("/proc/cpuinfo", "r");
+    if (f == NULL) return;
+    char line[256];
+    while (fgets(line, sizeof(line), f) != NULL) {
+        char* colon = strchr(line, ':');
+        if (strncmp(line, "model name", 10) != 0 || colon == NULL) continue;
+        colon += strspn(colon + 1, " \t") + 1;
+        colon[strcspn(colon, "\n")] = '\0';
+        snprintf(model, size, "%s", colon);
+        break;
+    }
+    fclose(f);
+}
+
+static void read_host_info(HostInfo* host) {
+    memset(host, 0, sizeof(*host));
+    if (gethostname(host->host, sizeof(host->host) - 1) != 0) snprintf(host->host, sizeof(host->host), "?");
+    uname(&host->uts);
+    read_cpu_model(host->cpu_model, sizeof(host->cpu_model));
+    host->n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+}
+
+// Escreve uma string JSON, escapando aspas, barras e caracteres de controle.
+static void json_string(FILE* f, const char* text) {
+    fputc('"', f);
+    for (const unsigned char* c = (const unsigned char*) (text ? text : ""); *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            fprintf(f, "\\%c", *c);
+        } else if (*c < 0x20) {
+            fprintf(f, "\\u%04x", *c);
+        } else {
+            fputc(*c, f);
+        }
+    }
+    fputc('"', f);
+}
+
+// Campo CSV: entre aspas só se tiver separador ou aspas.
+static void csv_field(FILE* f, const char* text) {
+    if (strpbrk(text, ",\"\n") == NULL) {
+        fputs(text, f);
+        return;
+    }
+    fputc('"', f);
+    for (const char* c = text; *c; c++) {
+        if (*c == '"') fputc('"', f);
+        fputc(*c, f);
+    }
+    fputc('"', f);
+}
+
+static void json_summary(FILE* f, const char* key, const Summary* s, int last) {
+    fprintf(f, "      \"%s\": { \"amostras\": %lu, \"media_ms\": %.6f, \"desvio_ms\": %.6f, \"min_ms\": %.6f, "
+               "\"p50_ms\": %.6f, \"p90_ms\": %.6f, \"p99_ms\": %.6f, \"p999_ms\": %.6f, \"max_ms\": %.6f }%s\n",
+            key, s->count, s->mean_ms, s->stddev_ms, s->min_ms, s->p50_ms, s->p90_ms, s->p99_ms, s->p999_ms,
+            s->max_ms, last ? "" : ",");
+}
+
+static int write_json(const char* filename, const ReportRun* run, const HostInfo* host, const char* started,
+                      const TaskRuntime* rts, const int* priorities, int n) {
+    FILE* f = fopen(filename, "w");
+    if (f == NULL) {
+        perror("Erro ao criar o relatório JSON");
+        return -1;
+    }
+    fprintf(f, "{\n  \"formato\": %d,\n  \"execucao\": {\n    \"inicio\": ", REPORT_FORMAT_VERSION);
+    json_string(f, started);
+    fprintf(f, ",\n    \"duracao_s\": %.3f,\n    \"log\": ", run->duration_s);
+    json_string(f, run->log_filename);
+    fprintf(f, ",\n    \"politica\": ");
+    json_string(f, run->policy);
+    fprintf(f, ",\n    \"modo\": ");
+    json_string(f, run->mode);
+    fprintf(f, ",\n    \"lockfree\": %s,\n    \"encadeado\": %s,\n    \"carga\": ", run->lockfree ? "true" : "false",
+            run->chained ? "true" : "false");
+    json_string(f, run->load);
+    fprintf(f, ",\n    \"estouro\": ");
+    json_string(f, run->overrun);
+    fprintf(f, ",\n    \"trajetoria\": ");
+    json_string(f, run->trajectory);
+    fprintf(f, "\n  },\n  \"maquina\": {\n    \"host\": ");
+    json_string(f, host->host);
+    fprintf(f, ",\n    \"kernel\": ");
+    json_string(f, host->uts.sysname);
+    fprintf(f, ",\n    \"kernel_release\": ");
+    json_string(f, host->uts.release);
+    fprintf(f, ",\n    \"kernel_versao\": ");
+    json_string(f, host->uts.version);
+    fprintf(f, ",\n    \"arquitetura\": ");
+    json_string(f, host->uts.machine);
+    fprintf(f, ",\n    \"cpu\": ");
+    json_string(f, host->cpu_model);
+    fprintf(f, ",\n    \"cpus\": %ld\n  },\n  \"tarefas\": [\n", host->n_cpus);
+
+    for (int i = 0; i < n; i++) {
+        const TaskRuntime* rt = &rts[i];
+        Summary dists[NUM_DISTS];
+        summarize_task(rt, dists);
+        fprintf(f, "    {\n      \"nome\": ");
+        json_string(f, rt->desc->name);
+        fprintf(f, ",\n      \"periodo_nominal_ms\": %.3f,\n      \"periodo_final_ms\": %.3f,\n"
+                   "      \"deadline_ms\": %.3f,\n      \"prioridade_rm\": %d,\n      \"disparada\": %s,\n"
+                   "      \"politica_estouro\": \"%s\",\n      \"jobs\": %ld,\n      \"perdas\": %ld,\n"
+                   "      \"pior_atraso_ms\": %.6f,\n      \"descartados\": %ld,\n      \"degradados\": %ld,\n"
+                   "      \"recuperados\": %ld,\n      \"trocas_de_periodo\": %ld,\n",
+                rt->desc->period_s * 1000.0, task_period_s(rt) * 1000.0, rt->timer.deadline_ns / 1e6,
+                priorities[i], rt->triggered ? "true" : "false", overrun_policy_name(rt->overrun), rt->timer.jobs,
+                rt->timer.deadline_misses, rt->timer.max_lateness_ms, rt->skipped_jobs, rt->degraded_jobs,
+                rt->immediate_jobs, rt->period_changes);
+        int last = rt->triggered ? DIST_CHAIN : DIST_BLOCKING; // Resposta de cadeia só nas disparadas
+        for (int d = 0; d <= last; d++) json_summary(f, dist_keys[d], &dists[d], d == last);
+        fprintf(f, "    }%s\n", i + 1 < n ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    return 0;
+}
+
+static int write_csv(const char* filename, const ReportRun* run, const HostInfo* host, const char* started,
+                     const TaskRuntime* rts, const int* priorities, int n) {
+    static const char* const stats[] = { "amostras", "media_ms", "desvio_ms", "min_ms", "p50_ms", "p90_ms",
+                                         "p99_ms", "p999_ms", "max_ms" };
+    FILE* f = fopen(filename, "w");
+    if (f == NULL) {
+        perror("Erro ao criar o relatório CSV");
+        return -1;
+    }
+    // Cabeçalho: identificação da execução, configuração da tarefa, contadores e distribuições.
+    fprintf(f, "inicio,politica,modo,carga,kernel_release,cpu,tarefa,periodo_nominal_ms,periodo_final_ms,"
+               "deadline_ms,prioridade_rm,jobs,perdas,pior_atraso_ms,descartados,degradados,recuperados,"
+               "trocas_de_periodo");
+    for (int d = 0; d < NUM_DISTS; d++) {
+        for (size_t k = 0; k < sizeof(stats) / sizeof(stats[0]); k++) fprintf(f, ",%s_%s", dist_keys[d], stats[k]);
+    }
+    fprintf(f, "\n");
+
+    for (int i = 0; i < n; i++) {
+        const TaskRuntime* rt = &rts[i];
+        Summary dists[NUM_DISTS];
+        summarize_task(rt, dists);
+        const char* identity[] = { started, run->policy, run->mode, run->load, host->uts.release, host->cpu_model,
+                                   rt->desc->name };
+        for (size_t k = 0; k < sizeof(identity) / sizeof(identity[0]); k++) {
+            if (k > 0) fputc(',', f);
+            csv_field(f, identity[k]);
+        }
+        fprintf(f, ",%.3f,%.3f,%.3f,%d,%ld,%ld,%.6f,%ld,%ld,%ld,%ld", rt->desc->period_s * 1000.0,
+                task_period_s(rt) * 1000.0, rt->timer.deadline_ns / 1e6, priorities[i], rt->timer.jobs,
+                rt->timer.deadline_misses, rt->timer.max_lateness_ms, rt->skipped_jobs, rt->degraded_jobs,
+                rt->immediate_jobs, rt->period_changes);
+        for (int d = 0; d < NUM_DISTS; d++) {
+            const Summary* s = &dists[d];
+            fprintf(f, ",%lu,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f", s->count, s->mean_ms, s->stddev_ms, s->min_ms,
+                    s->p50_ms, s->p90_ms, s->p99_ms, s->p999_ms, s->max_ms);
+        }
+        fprintf(f, "\n");
+    }
+    fclose(f);
+    return 0;
+}
+
+// Implementação da exportação.
+int report_export(const char* base, const ReportRun* run, const TaskRuntime* rts, const int* priorities, int n) {
+    HostInfo host;
+    char started[32], filename[192];
+    struct tm local;
+    read_host_info(&host);
+    localtime_r(&run->started, &local);
+    strftime(started, sizeof(started), "%Y-%m-%dT%H:%M:%S%z", &local);
+
+    snprintf(filename, sizeof(filename), "%s_relatorio.json", base);
+    int status = write_json(filename, run, &host, started, rts, priorities, n);
+    snprintf(filename, sizeof(filename), "%s_relatorio.csv", base);
+    if (write_csv(filename, run, &host, started, rts, priorities, n) != 0) status = -1;
+    return status;
+}
+
+// --- Comparação entre Execuções ---
+
+// Separa uma linha do CSV escrito por csv_field, no próprio buffer: campos entre
+// aspas podem ter vírgulas e aspas duplicadas. Retorna o número de campos.
+static int csv_split(char* line, char** fields, int max) {
+    int n = 0;
+    char* c = line;
+    while (n < max) {
+        char* out = c;
+        fields[n++] = c;
+        if (*c == '"') {
+            for (c++; *c != '\0'; c++) {
+                if (*c == '"' && c[1] == '"') {
+                    *out++ = '"';
+                    c++;
+                } else if (*c == '"') {
+                    c++;
+                    break;
+                } else {
+                    *out++ = *c;
+                }
+            }
+        } else {
+            while (*c != '\0' && *c != ',' && *c != '\n' && *c != '\r') *out++ = *c++;
+        }
+        int more = (*c == ',');
+        *out = '\0';
+        if (!more) break;
+        c++;
+    }
+    return n;
+}
+
+static int csv_column(char* const* fields, int n, const char* name) {
+    for (int k = 0; k < n; k++) {
+        if (strcmp(fields[k], name) == 0) return k;
+    }
+    return -1;
+}
+
+// Jitter de uma tarefa: p50, p99 e |J| máximo (o maior afastamento, para mais ou para menos).
+typedef struct {
+    int found;
+    double p50_ms, p99_ms, abs_max_ms;
+} JitterRow;
+
+static void print_jitter_cells(const JitterRow* row, int metric) {
+    if (!row->found) {
+        printf(" %14s |", "-");
+        return;
+    }
+    double value = metric == 0 ? row->p50_ms : (metric == 1 ? row->p99_ms : row->abs_max_ms);
+    printf(" %14.3f |", value);
+}
+
+// Implementação da comparação: as colunas do relatório anterior são localizadas
+// pelo nome no cabeçalho, e as tarefas pelo nome.
+int report_print_jitter_comparison(const char* baseline, const char* label, const TaskRuntime* rts, int n) {
+    enum { MAX_FIELDS = 128 };
+    char filename[192], line[8192], policy[64] = "?";
+    char* fields[MAX_FIELDS];
+    snprintf(filename, sizeof(filename), "%s_relatorio.csv", baseline);
+    FILE* f = fopen(filename, "r");
+    if (f == NULL) return -1;
+    if (fgets(line, sizeof(line), f) == NULL) {
+        fclose(f);
+        return -1;
+    }
+    int n_fields = csv_split(line, fields, MAX_FIELDS);
+    int col_policy = csv_column(fields, n_fields, "politica");
+    int col_task = csv_column(fields, n_fields, "tarefa");
+    int col_min = csv_column(fields, n_fields, "jitter_min_ms");
+    int col_p50 = csv_column(fields, n_fields, "jitter_p50_ms");
+    int col_p99 = csv_column(fields, n_fields, "jitter_p99_ms");
+    int col_max = csv_column(fields, n_fields, "jitter_max_ms");
+    if (col_task < 0 || col_min < 0 || col_p50 < 0 || col_p99 < 0 || col_max < 0) {
+        fprintf(stderr, "%s: sem as colunas de jitter (formato diferente?).\n", filename);
+        fclose(f);
+        return -1;
+    }
+
+    JitterRow* before = calloc((size_t) n, sizeof(JitterRow));
+    if (before == NULL) {
+        fclose(f);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f) != NULL) {
+        n_fields = csv_split(line, fields, MAX_FIELDS);
+        if (n_fields <= col_max || n_fields <= col_task) continue;
+        if (col_policy >= 0 && col_policy < n_fields) snprintf(policy, sizeof(policy), "%s", fields[col_policy]);
+        for (int i = 0; i < n; i++) {
+            if (strcmp(fields[col_task], rts[i].desc->name) != 0) continue;
+            before[i] = (JitterRow) { 1, atof(fields[col_p50]), atof(fields[col_p99]),
+                                      fmax(fabs(atof(fields[col_min])), fabs(atof(fields[col_max]))) };
+        }
+    }
+    fclose(f);
+
+    static const char* const metrics[] = { "p50", "p99", "|J| máx" };
+    printf("\n--- Jitter J(k) lado a lado, em ms (padrão: %s, de %s) ---\n", policy, filename);
+    printf("| Tarefa         |");
+    for (int m = 0; m < 3; m++) {
+        char cell[2][32];
+        snprintf(cell[0], sizeof(cell[0]), "%s padrão", metrics[m]);
+        snprintf(cell[1], sizeof(cell[1]), "%s %s", metrics[m], label);
+        for (int k = 0; k < 2; k++) printf(" %*s |", text_field_width(cell[k], 14), cell[k]);
+    }
+    printf("\n|----------------|");
+    for (int k = 0; k < 6; k++) printf("----------------|");
+    printf("\n");
+    for (int i = 0; i < n; i++) {
+        const TaskRuntime* rt = &rts[i];
+        Summary jitter = summarize_jitter(rt);
+        JitterRow now = { jitter.count > 0, jitter.p50_ms, jitter.p99_ms,
+                          fmax(fabs(jitter.min_ms), fabs(jitter.max_ms)) };
+        printf("| %-*s |", text_field_width(rt->desc->name, 14), rt->desc->name);
+        for (int m = 0; m < 3; m++) {
+            print_jitter_cells(&before[i], m);
+            print_jitter_cells(&now, m);
+        }
+        printf("\n");
+    }
+    free(before);
+    return 0;
+}
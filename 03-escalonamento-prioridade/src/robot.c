@@ -1,6 +1,7 @@
 #include <math.h>
 #include <stdlib.h>
 #include "robot.h"
+#include "fastmath.h"
 
 // Aloca memória para a estrutura RobotState e as matrizes internas.
 RobotState* create_robot_state() {
@@ -30,10 +31,12 @@ void update_state(RobotState* state, double dt) {
     double v = state->u->data[0][0];
     double omega = state->u->data[1][0];
     double theta = state->x->data[2][0];
+    double sin_theta, cos_theta;
+    fast_sincos(theta, &sin_theta, &cos_theta);
 
     // Modelo cinemático atualizado para o padrão (cos/sin).
-    double dx1_dt = v * cos(theta);
-    double dx2_dt = v * sin(theta);
+    double dx1_dt = v * cos_theta;
+    double dx2_dt = v * sin_theta;
     double dx3_dt = omega;
 
     // Aplica o método de integração de Euler para encontrar o novo estado.
@@ -49,8 +52,10 @@ void calculate_output_y(RobotState* state) {
     double theta = state->x->data[2][0];
     // Raio R atualizado para 0.3m (D=0.6m).
     double radius = ROBOT_DIAMETER / 2.0;
+    double sin_theta, cos_theta;
+    fast_sincos(theta, &sin_theta, &cos_theta);
 
     // Nova equação de saída
-    state->y->data[0][0] = xc + radius * cos(theta); // Posição X da frente
-    state->y->data[1][0] = yc + radius * sin(theta); // Posição Y da frente
+    state->y->data[0][0] = xc + radius * cos_theta; // Posição X da frente
+    state->y->data[1][0] = yc + radius * sin_theta; // Posição Y da frente
 }
\ No newline at end of file
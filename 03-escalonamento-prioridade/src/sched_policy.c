@@ -0,0 +1,209 @@
+#define _GNU_SOURCE // Habilita pthread_setname_np
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sched.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include "sched_policy.h"
+
+#ifndef SCHED_DEADLINE
+#define SCHED_DEADLINE 6
+#endif
+#ifndef SCHED_FLAG_RESET_ON_FORK
+#define SCHED_FLAG_RESET_ON_FORK 0x01
+#endif
+
+// Layout da struct sched_attr do kernel (a glibc não a expõe nesta versão).
+typedef struct {
+    uint32_t size;
+    uint32_t sched_policy;
+    uint64_t sched_flags;
+    int32_t sched_nice;
+    uint32_t sched_priority;
+    uint64_t sched_runtime;   // ns
+    uint64_t sched_deadline;  // ns
+    uint64_t sched_period;    // ns
+} DeadlineAttr;
+
+// Argumentos repassados ao trampolim que pré-falha a pilha antes da tarefa.
+typedef struct {
+    void* (*fn)(void*);
+    void* arg;
+} ThreadStart;
+
+// Toca as primeiras páginas da pilha: com mlockall(MCL_FUTURE) elas ficam
+// residentes e a tarefa não sofre faltas de página no meio de um job.
+static void* prefault_trampoline(void* start_arg) {
+    ThreadStart start = *(ThreadStart*) start_arg;
+    free(start_arg);
+
+    // Uma escrita por página, sempre pelo ponteiro volatile: um memset sobre o
+    // buffer sem o volatile seria um armazenamento morto que o compilador pode
+    // eliminar, e a pilha não seria pré-falhada.
+    volatile char stack_touch[RT_STACK_PREFAULT];
+    long page = sysconf(_SC_PAGESIZE);
+    if (page <= 0) page = 4096;
+    for (size_t i = 0; i < sizeof(stack_touch); i += (size_t) page) stack_touch[i] = 0;
+    stack_touch[sizeof(stack_touch) - 1] = 0;
+
+    return start.fn(start.arg);
+}
+
+// Implementação da atribuição Rate Monotonic.
+void rm_assign_priorities(RmTask* tasks, int n) {
+    for (int i = 0; i < n; i++) {
+        // O posto é o número de períodos distintos estritamente menores.
+        int rank = 0;
+        for (int j = 0; j < n; j++) {
+            if (tasks[j].period_s >= tasks[i].period_s) continue;
+            int first = 1; // Conta cada período menor uma única vez
+            for (int k = 0; k < j; k++) {
+                if (tasks[k].period_s == tasks[j].period_s) { first = 0; break; }
+            }
+            rank += first;
+        }
+        int priority = RM_PRIORITY_TOP - rank;
+        int min_priority = sched_get_priority_min(SCHED_FIFO);
+        tasks[i].priority = (priority < min_priority) ? min_priority : priority;
+    }
+}
+
+// Implementação do travamento de memória.
+int sched_lock_memory(void) {
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) == 0) {
+        printf("[sched] Memória travada com mlockall(MCL_CURRENT | MCL_FUTURE).\n");
+        return 1;
+    }
+    fprintf(stderr, "[sched] AVISO: mlockall falhou (%s); faltas de página podem gerar jitter.\n",
+            strerror(errno));
+    return 0;
+}
+
+// Nomeia a thread (visível em top -H e ps -L). O kernel aceita até 15 bytes:
+// nomes maiores são cortados antes, sem partir um caractere UTF-8 ao meio, em
+// vez de deixar pthread_setname_np falhar com ERANGE.
+static void name_thread(pthread_t tid, const char* name) {
+    char short_name[16];
+    size_t length = strlen(name);
+    if (length >= sizeof(short_name)) {
+        length = sizeof(short_name) - 1;
+        while (length > 0 && ((unsigned char) name[length] & 0xC0) == 0x80) length--;
+    }
+    memcpy(short_name, name, length);
+    short_name[length] = '\0';
+    pthread_setname_np(tid, short_name);
+}
+
+// Implementação da criação de threads com política explícita.
+int sched_create_thread(pthread_t* tid, const char* name, int use_fifo, int priority,
+                        void* (*fn)(void*), void* arg) {
+    if (!use_fifo) {
+        if (pthread_create(tid, NULL, fn, arg) != 0) return -1;
+        name_thread(*tid, name);
+        return SCHED_APPLIED_DEFAULT;
+    }
+
+    ThreadStart* start = (ThreadStart*) malloc(sizeof(ThreadStart));
+    if (start == NULL) return -1;
+    start->fn = fn;
+    start->arg = arg;
+
+    pthread_attr_t attr;
+    struct sched_param param = { .sched_priority = priority };
+    pthread_attr_init(&attr);
+    pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+    pthread_attr_setschedparam(&attr, &param);
+    pthread_attr_setstacksize(&attr, RT_STACK_SIZE);
+
+    int err = pthread_create(tid, &attr, prefault_trampoline, start);
+    pthread_attr_destroy(&attr);
+    if (err == 0) {
+        name_thread(*tid, name);
+        return SCHED_APPLIED_FIFO;
+    }
+    // Só a falta de privilégio justifica o fallback; EAGAIN (limite de threads)
+    // ou EINVAL (atributos) são erros reais e são devolvidos.
+    if (err != EPERM) {
+        fprintf(stderr, "[sched] Erro ao criar a thread '%s' (%s).\n", name, strerror(err));
+        free(start);
+        return -1;
+    }
+
+    // Sem CAP_SYS_NICE (ou RLIMIT_RTPRIO) o kernel recusa SCHED_FIFO: segue em melhor esforço.
+    fprintf(stderr, "[sched] AVISO: SCHED_FIFO prio %d negado para '%s' (%s); usando SCHED_OTHER.\n",
+            priority, name, strerror(err));
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, RT_STACK_SIZE);
+    err = pthread_create(tid, &attr, prefault_trampoline, start);
+    pthread_attr_destroy(&attr);
+    if (err != 0) {
+        free(start);
+        return -1;
+    }
+    name_thread(*tid, name);
+    return SCHED_APPLIED_FALLBACK;
+}
+
+// Implementação da inicialização do estado EDF.
+void edf_task_init(EdfTask* task, const char* name, double period_s) {
+    task->name = name;
+    task->period_s = period_s;
+    task->deadline_s = period_s;
+    task->observed_jobs = 0;
+    task->max_ci_s = 0.0;
+    task->runtime_s = 0.0;
+    task->applied = SCHED_APPLIED_DEFAULT;
+}
+
+// Implementação da migração para SCHED_DEADLINE após o aquecimento.
+void edf_observe_job(EdfTask* task, double ci_ms) {
+    if (task->observed_jobs >= EDF_WARMUP_JOBS) return;
+    if (ci_ms / 1000.0 > task->max_ci_s) task->max_ci_s = ci_ms / 1000.0;
+    if (++task->observed_jobs < EDF_WARMUP_JOBS) return;
+
+    double runtime_s = task->max_ci_s * EDF_RUNTIME_MARGIN;
+    if (runtime_s < EDF_MIN_RUNTIME_S) runtime_s = EDF_MIN_RUNTIME_S;
+    if (runtime_s > task->deadline_s) runtime_s = task->deadline_s;
+
+    // RESET_ON_FORK: o kernel recusa fork() (EAGAIN) de uma thread SCHED_DEADLINE
+    // sem essa flag. Nenhuma tarefa cria processos hoje, mas com a flag um fork
+    // vindo de uma biblioteca ainda funciona, e o filho nasce em SCHED_OTHER em
+    // vez de herdar (e dividir) a reserva de runtime da tarefa.
+    DeadlineAttr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.sched_policy = SCHED_DEADLINE;
+    attr.sched_flags = SCHED_FLAG_RESET_ON_FORK;
+    attr.sched_runtime = (uint64_t) (runtime_s * 1e9);
+    attr.sched_deadline = (uint64_t) (task->deadline_s * 1e9);
+    attr.sched_period = (uint64_t) (task->period_s * 1e9);
+
+    if (syscall(SYS_sched_setattr, 0, &attr, 0) == 0) {
+        task->runtime_s = runtime_s;
+        task->applied = SCHED_APPLIED_DEADLINE;
+        return;
+    }
+
+    // EPERM: sem privilégio; EINVAL/ENOSYS: kernel sem SCHED_DEADLINE;
+    // EBUSY: o controle de admissão recusou a reserva.
+    fprintf(stderr, "[sched] AVISO: SCHED_DEADLINE negado para '%s' (%s); continuando em SCHED_OTHER.\n",
+            task->name, strerror(errno));
+    task->applied = SCHED_APPLIED_EDF_FALLBACK;
+}
+
+// Implementação do nome da política aplicada.
+const char* sched_applied_name(int applied) {
+    switch (applied) {
+        case SCHED_APPLIED_FIFO:         return "SCHED_FIFO";
+        case SCHED_APPLIED_FALLBACK:     return "SCHED_OTHER (fallback)";
+        case SCHED_APPLIED_DEADLINE:     return "SCHED_DEADLINE";
+        case SCHED_APPLIED_EDF_FALLBACK: return "SCHED_OTHER (fallback EDF)";
+        default:                         return "SCHED_OTHER";
+    }
+}
@@ -0,0 +1,64 @@
+#include <stdint.h>
+#include "seqlock.h"
+
+// A cópia é feita palavra a palavra com acessos atômicos relaxados: a leitura
+// concorrente com a escrita é esperada (e descartada), mas não é uma corrida
+// de dados no sentido do C11.
+static void copy_words_in(uint64_t* dst, const uint64_t* src, size_t words) {
+    for (size_t i = 0; i < words; i++) {
+        dst[i] = __atomic_load_n(&src[i], __ATOMIC_RELAXED);
+    }
+}
+
+static void copy_words_out(uint64_t* dst, const uint64_t* src, size_t words) {
+    for (size_t i = 0; i < words; i++) {
+        __atomic_store_n(&dst[i], src[i], __ATOMIC_RELAXED);
+    }
+}
+
+// Implementação da inicialização.
+void seqlock_init(SeqLock* lock) {
+    atomic_init(&lock->sequence[0], 0);
+    atomic_init(&lock->sequence[1], 0);
+    atomic_init(&lock->current, 0);
+    atomic_init(&lock->writes, 0);
+    atomic_init(&lock->read_retries, 0);
+}
+
+// Implementação da escrita: grava no slot livre (sequência ímpar -> dados ->
+// sequência par) e só então o publica.
+void seqlock_write(SeqLock* lock, void* slots, const void* value, size_t size) {
+    unsigned slot = 1u - atomic_load_explicit(&lock->current, memory_order_relaxed);
+    uint64_t* dst = (uint64_t*) ((char*) slots + slot * size);
+
+    unsigned seq = atomic_load_explicit(&lock->sequence[slot], memory_order_relaxed);
+    atomic_store_explicit(&lock->sequence[slot], seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    copy_words_out(dst, (const uint64_t*) value, size / sizeof(uint64_t));
+
+    atomic_store_explicit(&lock->sequence[slot], seq + 2, memory_order_release);
+    atomic_store_explicit(&lock->current, slot, memory_order_release);
+    atomic_fetch_add_explicit(&lock->writes, 1, memory_order_relaxed);
+}
+
+// Implementação da tentativa de leitura: falha apenas se o slot lido foi
+// reescrito durante a cópia. Não escreve no seqlock.
+int seqlock_try_read(const SeqLock* lock, const void* slots, void* value, size_t size) {
+    unsigned slot = atomic_load_explicit(&lock->current, memory_order_acquire);
+    const uint64_t* src = (const uint64_t*) ((const char*) slots + slot * size);
+
+    unsigned before = atomic_load_explicit(&lock->sequence[slot], memory_order_acquire);
+    if ((before & 1u) != 0) return -1;
+    copy_words_in((uint64_t*) value, src, size / sizeof(uint64_t));
+    atomic_thread_fence(memory_order_acquire);
+    unsigned after = atomic_load_explicit(&lock->sequence[slot], memory_order_relaxed);
+    return before == after ? 0 : -1;
+}
+
+// Implementação da leitura: repete a tentativa até obter uma cópia íntegra.
+void seqlock_read(SeqLock* lock, const void* slots, void* value, size_t size) {
+    while (seqlock_try_read(lock, slots, value, size) != 0) {
+        atomic_fetch_add_explicit(&lock->read_retries, 1, memory_order_relaxed);
+    }
+}
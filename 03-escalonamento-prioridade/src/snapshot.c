@@ -0,0 +1,41 @@
+#include "snapshot.h"
+
+// Copia x, u e y do estado do robô para o instantâneo.
+void robot_to_snapshot(const RobotState* state, RobotSnapshot* snap) {
+    for (int i = 0; i < 3; i++) snap->x[i] = state->x->data[i][0];
+    for (int i = 0; i < 2; i++) {
+        snap->u[i] = state->u->data[i][0];
+        snap->y[i] = state->y->data[i][0];
+    }
+}
+
+// Restaura x, u e y de um instantâneo para um estado do robô (visão local).
+void robot_from_snapshot(RobotState* state, const RobotSnapshot* snap) {
+    for (int i = 0; i < 3; i++) state->x->data[i][0] = snap->x[i];
+    for (int i = 0; i < 2; i++) {
+        state->u->data[i][0] = snap->u[i];
+        state->y->data[i][0] = snap->y[i];
+    }
+}
+
+// Copia a referência [xref, yref] para o instantâneo.
+void reference_to_snapshot(const ReferenceTrajectory* ref, ReferenceSnapshot* snap) {
+    snap->ref_xy[0] = ref->ref_xy->data[0][0];
+    snap->ref_xy[1] = ref->ref_xy->data[1][0];
+}
+
+// Copia y_m e dot_y_m do modelo de referência para o instantâneo.
+void ref_model_to_snapshot(const RefModel* model, RefModelSnapshot* snap) {
+    for (int i = 0; i < 2; i++) {
+        snap->y_m[i] = model->y_m->data[i][0];
+        snap->dot_y_m[i] = model->dot_y_m->data[i][0];
+    }
+}
+
+// Restaura y_m e dot_y_m de um instantâneo (visão local do modelo).
+void ref_model_from_snapshot(RefModel* model, const RefModelSnapshot* snap) {
+    for (int i = 0; i < 2; i++) {
+        model->y_m->data[i][0] = snap->y_m[i];
+        model->dot_y_m->data[i][0] = snap->dot_y_m[i];
+    }
+}
@@ -0,0 +1,408 @@
+#define _GNU_SOURCE // Habilita pthread_setaffinity_np
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <errno.h>
+#include <semaphore.h>
+#include <unistd.h>
+#include "task.h"
+#include "textwidth.h"
+
+// Diferença (a - b) em milissegundos.
+static double timespec_diff_ms(const struct timespec* a, const struct timespec* b) {
+    return (a->tv_sec - b->tv_sec) * 1000.0 + (a->tv_nsec - b->tv_nsec) / 1000000.0;
+}
+
+// Diferença (a - b) em nanossegundos, saturada em 0 (para os histogramas).
+static uint64_t timespec_diff_ns(const struct timespec* a, const struct timespec* b) {
+    int64_t ns = (int64_t) (a->tv_sec - b->tv_sec) * 1000000000LL + (a->tv_nsec - b->tv_nsec);
+    return ns > 0 ? (uint64_t) ns : 0;
+}
+
+static uint64_t timespec_to_ns(const struct timespec* ts) {
+    return (uint64_t) ts->tv_sec * 1000000000ULL + (uint64_t) ts->tv_nsec;
+}
+
+// 1 se a ocorre antes de b.
+static int timespec_before(const struct timespec* a, const struct timespec* b) {
+    return a->tv_sec < b->tv_sec || (a->tv_sec == b->tv_sec && a->tv_nsec < b->tv_nsec);
+}
+
+static struct timespec ns_to_timespec(uint64_t ns) {
+    struct timespec ts = { (time_t) (ns / 1000000000ULL), (long) (ns % 1000000000ULL) };
+    return ts;
+}
+
+// Implementação da inicialização.
+void task_runtime_init(TaskRuntime* rt, const TaskDescriptor* desc, int id, volatile int* running,
+                       const struct timespec* first_release) {
+    rt->desc = desc;
+    rt->id = id;
+    rt->running = running;
+    rt->edf = NULL;
+    rt->telemetry = NULL;
+    rt->warmed_up = 0;
+    histogram_init(&rt->period_ns);
+    deviation_init(&rt->jitter_ns);
+    histogram_init(&rt->computation_ns);
+    histogram_init(&rt->response_ns);
+    histogram_init(&rt->chain_response_ns);
+    if (first_release != NULL) {
+        periodic_init_at(&rt->timer, desc->period_s, first_release);
+    } else {
+        periodic_init(&rt->timer, desc->period_s);
+    }
+    periodic_set_deadline(&rt->timer, task_deadline_s(desc));
+    rt->origin = rt->timer.next_release;
+
+    rt->triggered = 0;
+    rt->consumer = NULL;
+    sem_init(&rt->trigger, 0, 0);
+    atomic_init(&rt->trigger_ns, 0);
+    atomic_init(&rt->chain_ns, 0);
+    rt->chain_release = rt->origin;
+    rt->lost_triggers = 0;
+
+    rt->overrun = desc->overrun;
+    rt->late_until = (struct timespec) { 0, 0 };
+    rt->skipped_jobs = 0;
+    rt->degraded_jobs = 0;
+    rt->immediate_jobs = 0;
+    rt->miss_count = 0;
+
+    atomic_init(&rt->requested_period_ns, 0);
+    rt->period_changes = 0;
+}
+
+// Implementação do deadline efetivo.
+double task_deadline_s(const TaskDescriptor* desc) {
+    return desc->deadline_s > 0.0 ? desc->deadline_s : desc->period_s;
+}
+
+// Implementação do período efetivo.
+double task_period_s(const TaskRuntime* rt) {
+    return rt->timer.period_ns / 1e9;
+}
+
+// Implementação do encadeamento.
+double task_chain(TaskRuntime* const* chain, int n) {
+    double period_s = chain[0]->desc->period_s;
+    for (int i = 1; i < n; i++) {
+        if (chain[i]->desc->period_s < period_s) period_s = chain[i]->desc->period_s;
+    }
+    for (int i = 0; i < n; i++) {
+        TaskRuntime* rt = chain[i];
+        double deadline_s = task_deadline_s(rt->desc);
+        periodic_init_at(&rt->timer, period_s, &rt->origin);
+        periodic_set_deadline(&rt->timer, deadline_s < period_s ? deadline_s : period_s);
+        rt->triggered = (i > 0);
+        rt->consumer = (i + 1 < n) ? chain[i + 1] : NULL;
+    }
+    return period_s;
+}
+
+// Implementação do despertar.
+void task_wake(TaskRuntime* rt) {
+    if (rt->triggered) sem_post(&rt->trigger);
+}
+
+// Repassa ao consumidor o fim deste job e a liberação da cabeça da cadeia. A
+// notificação é binária: se a anterior ainda não foi consumida, só o instante
+// é atualizado (o consumidor roda uma vez, com o dado mais novo).
+static void notify_consumer(TaskRuntime* rt, const struct timespec* finish) {
+    TaskRuntime* consumer = rt->consumer;
+    atomic_store(&consumer->chain_ns, timespec_to_ns(&rt->chain_release));
+    atomic_store(&consumer->trigger_ns, timespec_to_ns(finish));
+    int pending = 0;
+    sem_getvalue(&consumer->trigger, &pending);
+    if (pending > 0) {
+        consumer->lost_triggers++;
+    } else {
+        sem_post(&consumer->trigger);
+    }
+}
+
+// Publica os contadores da tarefa para monitores externos (telemetry.h). Só
+// depois de jobs executados: os descartados aparecem na publicação seguinte.
+static void publish_telemetry(const TaskRuntime* rt, const struct timespec* start, const struct timespec* finish) {
+    uint64_t jitter_max = rt->jitter_ns.below.max > rt->jitter_ns.above.max ? rt->jitter_ns.below.max
+                                                                            : rt->jitter_ns.above.max;
+    TelemetryTask task = {
+        (uint64_t) rt->timer.jobs, (uint64_t) rt->timer.deadline_misses,
+        (uint64_t) rt->skipped_jobs, (uint64_t) rt->degraded_jobs,
+        task_period_s(rt) * 1000.0,
+        timespec_diff_ms(finish, start), rt->computation_ns.mean / 1e6, rt->computation_ns.max / 1e6,
+        timespec_diff_ms(finish, &rt->timer.last_release), rt->response_ns.max / 1e6,
+        jitter_max / 1e6, rt->timer.max_lateness_ms,
+    };
+    telemetry_publish_task(rt->telemetry, &task);
+}
+
+// Implementação da execução de um job.
+void task_run_job(TaskRuntime* rt) {
+    struct timespec start, finish;
+    TaskBody body = rt->desc->body;
+    if (!rt->triggered) rt->chain_release = rt->timer.last_release;
+
+    // Liberado antes do fim do último job atrasado: aplica a política de estouro.
+    // O efeito é somado à última perda da linha do tempo, se ela foi guardada.
+    if (timespec_before(&rt->timer.last_release, &rt->late_until)) {
+        if (rt->timer.deadline_misses <= TASK_MAX_MISSES) rt->misses[rt->miss_count - 1].affected++;
+        if (rt->overrun == OVERRUN_IMMEDIATE) {
+            rt->immediate_jobs++;
+        } else if (rt->overrun == OVERRUN_DEGRADE && rt->desc->degraded != NULL) {
+            rt->degraded_jobs++;
+            body = rt->desc->degraded;
+        } else {
+            rt->skipped_jobs++; // Sem corpo, sem deadline e sem notificar o consumidor
+            return;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    body(rt->desc->state);
+
+    clock_gettime(CLOCK_MONOTONIC, &finish);
+    double computation_ms = timespec_diff_ms(&finish, &start);
+    if (rt->warmed_up) {
+        uint64_t period_ns = timespec_diff_ns(&start, &rt->last_start);
+        histogram_record(&rt->period_ns, period_ns);
+        // Desvio em relação ao período que agendou esta liberação: logo após uma
+        // troca de período, o job ainda foi liberado com o período anterior.
+        deviation_record(&rt->jitter_ns, (int64_t) period_ns - rt->timer.job_period_ns);
+        histogram_record(&rt->computation_ns, timespec_diff_ns(&finish, &start));
+        histogram_record(&rt->response_ns, timespec_diff_ns(&finish, &rt->timer.last_release));
+        if (rt->triggered) histogram_record(&rt->chain_response_ns, timespec_diff_ns(&finish, &rt->chain_release));
+    }
+    rt->warmed_up = 1;
+    rt->last_start = start;
+    if (rt->consumer != NULL) notify_consumer(rt, &finish);
+
+    double lateness_ms = periodic_job_done(&rt->timer);
+    if (lateness_ms > 0.0) {
+        rt->late_until = finish;
+        if (rt->miss_count < TASK_MAX_MISSES) {
+            rt->misses[rt->miss_count++] = (DeadlineMiss) {
+                rt->timer.jobs, timespec_diff_ms(&rt->timer.last_release, &rt->origin), lateness_ms, rt->overrun, 0
+            };
+        }
+    }
+    monitor_job_done();
+    if (rt->edf != NULL) edf_observe_job(rt->edf, computation_ms);
+    if (rt->telemetry != NULL) publish_telemetry(rt, &start, &finish);
+}
+
+// Implementação dos nomes das políticas de estouro.
+static const char* const overrun_names[NUM_OVERRUN_POLICIES] = {
+    [OVERRUN_IMMEDIATE] = "imediato",
+    [OVERRUN_SKIP] = "descartar",
+    [OVERRUN_DEGRADE] = "degradar",
+};
+
+const char* overrun_policy_name(OverrunPolicy policy) {
+    return (policy >= 0 && policy < NUM_OVERRUN_POLICIES) ? overrun_names[policy] : "?";
+}
+
+int overrun_policy_parse(const char* name) {
+    for (int i = 0; i < NUM_OVERRUN_POLICIES; i++) {
+        if (strcmp(name, overrun_names[i]) == 0) return i;
+    }
+    return -1;
+}
+
+// Fixa a thread chamadora na CPU pedida; em caso de falha segue sem afinidade.
+static void apply_affinity(const TaskDescriptor* desc) {
+    if (desc->cpu == TASK_ANY_CPU) return;
+    long n_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(desc->cpu, &set);
+    int err = (desc->cpu < 0 || desc->cpu >= n_cpus) ? EINVAL
+            : pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (err != 0) {
+        fprintf(stderr, "[task] AVISO: afinidade da tarefa %s com a CPU %d falhou (%s).\n",
+                desc->name, desc->cpu, strerror(err));
+    }
+}
+
+// Implementação do pedido de troca de período.
+int task_request_period(TaskRuntime* rt, double period_s) {
+    if (rt->triggered || period_s <= 0.0) return -1;
+    atomic_store(&rt->requested_period_ns, (long) (period_s * 1e9 + 0.5));
+    return 0;
+}
+
+// Aplica um pedido de troca de período pendente (só a thread da tarefa escreve o temporizador).
+static void apply_period_request(TaskRuntime* rt) {
+    long period_ns = atomic_exchange(&rt->requested_period_ns, 0);
+    if (period_ns <= 0) return;
+    rt->timer.period_ns = period_ns;
+    if (rt->desc->deadline_s <= 0.0) rt->timer.deadline_ns = period_ns;
+    rt->period_changes++;
+}
+
+// Implementação do laço genérico.
+void* task_thread(void* arg) {
+    TaskRuntime* rt = (TaskRuntime*) arg;
+    apply_affinity(rt->desc);
+    monitor_register_task(rt->id, rt->desc->name);
+
+    while (*rt->running) {
+        if (rt->triggered) {
+            while (sem_wait(&rt->trigger) != 0 && errno == EINTR) {
+            }
+            if (!*rt->running) break;
+            struct timespec release = ns_to_timespec(atomic_load(&rt->trigger_ns));
+            rt->chain_release = ns_to_timespec(atomic_load(&rt->chain_ns));
+            periodic_start_job_at(&rt->timer, &release);
+        } else {
+            apply_period_request(rt);
+            periodic_wait_next(&rt->timer);
+        }
+        task_run_job(rt);
+    }
+    return NULL;
+}
+
+// Implementação do relatório.
+void task_print_report(const TaskRuntime* rt) {
+    const TaskDescriptor* desc = rt->desc;
+    char label[96];
+    snprintf(label, sizeof(label), "Thread %s (%.0fms)", desc->name, task_period_s(rt) * 1000.0);
+
+    if (rt->computation_ns.count > 0) {
+        const DeviationHistogram* jitter = &rt->jitter_ns;
+        printf("\n--- Jitter de Ativação (J = início -> início - %.0fms): %s ---\n", task_period_s(rt) * 1000.0, label);
+        printf("  - Período médio: %f ms (desvio padrão %f ms)\n", rt->period_ns.mean / 1e6,
+               histogram_stddev(&rt->period_ns) / 1e6);
+        printf("  - J mín / p50 / p90 / p99 / p99.9 / máx: %+f / %+f / %+f / %+f / %+f / %+f ms\n",
+               deviation_percentile(jitter, 0.0) / 1e6, deviation_percentile(jitter, 50.0) / 1e6,
+               deviation_percentile(jitter, 90.0) / 1e6, deviation_percentile(jitter, 99.0) / 1e6,
+               deviation_percentile(jitter, 99.9) / 1e6, deviation_percentile(jitter, 100.0) / 1e6);
+
+        printf("\n--- Análise de Tempo de Computação: %s ---\n", label);
+        histogram_print_ms(&rt->computation_ns, "Este é o seu 'Ci' estimado");
+
+        printf("\n--- Tempo de Resposta (liberação -> fim, D = %.0fms): %s ---\n",
+               rt->timer.deadline_ns / 1e6, label);
+        histogram_print_ms(&rt->response_ns, "Este é o seu 'Ri' observado");
+
+        if (rt->triggered) {
+            printf("\n--- Resposta Ponta a Ponta (liberação da cabeça da cadeia -> fim): %s ---\n", label);
+            histogram_print_ms(&rt->chain_response_ns, NULL);
+            printf("  - Notificações sobrepostas: %ld\n", rt->lost_triggers);
+        }
+    }
+    periodic_print_latency_stats(label, &rt->timer);
+    monitor_print_task_blocking(rt->id, label);
+}
+
+// Implementação do Ci medido.
+double task_max_computation_ms(const TaskRuntime* rt) {
+    return rt->computation_ns.count ? rt->computation_ns.max / 1e6 : 0.0;
+}
+
+// Implementação do jitter de liberação medido.
+double task_max_release_jitter_ms(const TaskRuntime* rt) {
+    return rt->timer.latency_ns.count ? rt->timer.latency_ns.max / 1e6 : 0.0;
+}
+
+// 1 se a tarefa declara o mutex no seu conjunto.
+static int uses_lock(const TaskDescriptor* desc, const MonitorMutex* m) {
+    for (int k = 0; k < TASK_MAX_LOCKS && desc->locks[k] != NULL; k++) {
+        if (desc->locks[k] == m) return 1;
+    }
+    return 0;
+}
+
+// Implementação do limite de bloqueio por herança de prioridade.
+double task_blocking_bound_ms(const TaskRuntime* rts, const int* priorities, int n, int i, int* unbounded) {
+    double bound_ns = 0.0;
+    if (unbounded != NULL) *unbounded = 0;
+    const MonitorMutex* seen[TASK_MAX_LOCKS * MONITOR_MAX_TASKS];
+    int n_seen = 0;
+    for (int t = 0; t < n; t++) {
+        for (int k = 0; k < TASK_MAX_LOCKS && rts[t].desc->locks[k] != NULL; k++) {
+            const MonitorMutex* m = rts[t].desc->locks[k];
+            int repeated = 0;
+            for (int s = 0; s < n_seen; s++) repeated |= (seen[s] == m);
+            if (repeated || n_seen >= (int) (sizeof(seen) / sizeof(seen[0]))) continue;
+            seen[n_seen++] = m;
+
+            // Teto do mutex: a maior prioridade entre as tarefas que o usam.
+            int ceiling = 0;
+            for (int u = 0; u < n; u++) {
+                if (uses_lock(rts[u].desc, m) && priorities[u] > ceiling) ceiling = priorities[u];
+            }
+            if (ceiling < priorities[i]) continue;
+
+            uint64_t longest_ns = 0;
+            for (int u = 0; u < n; u++) {
+                if (priorities[u] >= priorities[i] || !uses_lock(rts[u].desc, m)) continue;
+                uint64_t hold_ns = monitor_hold_max_ns(rts[u].id, m);
+                if (hold_ns > longest_ns) longest_ns = hold_ns;
+                if (!m->priority_inherit && unbounded != NULL) *unbounded = 1;
+            }
+            bound_ns += longest_ns;
+        }
+    }
+    return bound_ns / 1e6;
+}
+
+// Uma perda na linha do tempo combinada de todas as tarefas.
+typedef struct {
+    const TaskRuntime* rt;
+    const DeadlineMiss* miss;
+} TimelineEntry;
+
+static int compare_by_release(const void* a, const void* b) {
+    double ra = ((const TimelineEntry*) a)->miss->release_ms;
+    double rb = ((const TimelineEntry*) b)->miss->release_ms;
+    return (ra > rb) - (ra < rb);
+}
+
+// Implementação do relatório de perdas de deadline.
+void task_print_miss_report(const TaskRuntime* rts, int n) {
+    printf("\n--- Perdas de Deadline e Políticas de Estouro ---\n");
+    printf("| Tarefa         | Política  |  Jobs | Perdas | Pior atraso [ms] | Descartados | Degradados | Recuperados |\n");
+    printf("|----------------|-----------|-------|--------|------------------|-------------|------------|-------------|\n");
+    int total = 0;
+    for (int i = 0; i < n; i++) {
+        const TaskRuntime* rt = &rts[i];
+        printf("| %-*s | %-9s | %5ld | %6ld | %16.3f | %11ld | %10ld | %11ld |\n",
+               text_field_width(rt->desc->name, 14), rt->desc->name, overrun_policy_name(rt->overrun), rt->timer.jobs, rt->timer.deadline_misses, rt->timer.max_lateness_ms,
+               rt->skipped_jobs, rt->degraded_jobs, rt->immediate_jobs);
+        total += rt->miss_count;
+    }
+    if (total == 0) {
+        printf("  Nenhuma perda de deadline.\n");
+        return;
+    }
+
+    // Linha do tempo: as perdas guardadas de todas as tarefas, pela liberação.
+    TimelineEntry* timeline = malloc(total * sizeof(TimelineEntry));
+    if (timeline == NULL) return;
+    int k = 0;
+    for (int i = 0; i < n; i++) {
+        for (int m = 0; m < rts[i].miss_count; m++) {
+            timeline[k++] = (TimelineEntry) { &rts[i], &rts[i].misses[m] };
+        }
+    }
+    qsort(timeline, total, sizeof(TimelineEntry), compare_by_release);
+
+    printf("\nLinha do tempo (até %d perdas por tarefa; liberação em ms desde o início):\n", TASK_MAX_MISSES);
+    for (k = 0; k < total; k++) {
+        const DeadlineMiss* miss = timeline[k].miss;
+        const char* name = timeline[k].rt->desc->name;
+        printf("  %10.1f ms  %-*s job %-5ld atraso %8.3f ms", miss->release_ms, text_field_width(name, 14), name,
+               miss->job, miss->lateness_ms);
+        if (miss->affected > 0) {
+            printf("  -> %s %d job(s)", overrun_policy_name(miss->policy), miss->affected);
+        }
+        printf("\n");
+    }
+    free(timeline);
+}
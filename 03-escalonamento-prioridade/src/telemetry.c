@@ -0,0 +1,138 @@
+#define _DEFAULT_SOURCE // Habilita shm_open e mmap
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "telemetry.h"
+
+// Implementação da criação.
+Telemetry* create_telemetry(const char* name, const char* description, const char* const* task_names, int n_tasks) {
+    if (n_tasks < 1 || n_tasks > TELEMETRY_MAX_TASKS) return NULL;
+    Telemetry* telemetry = calloc(1, sizeof(Telemetry));
+    if (telemetry == NULL) return NULL;
+
+    // Um segmento de execução anterior é removido, não reaproveitado: monitores
+    // ainda presos a ele continuam vendo o fim daquela execução (active = 0).
+    shm_unlink(name);
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0) {
+        perror(name);
+        free(telemetry);
+        return NULL;
+    }
+    if (ftruncate(fd, sizeof(TelemetrySegment)) != 0) {
+        perror(name);
+        close(fd);
+        shm_unlink(name);
+        free(telemetry);
+        return NULL;
+    }
+    TelemetrySegment* segment = mmap(NULL, sizeof(TelemetrySegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (segment == MAP_FAILED) {
+        perror(name);
+        shm_unlink(name);
+        free(telemetry);
+        return NULL;
+    }
+
+    // O segmento novo vem zerado: falta só o cabeçalho e a primeira publicação de cada bloco.
+    segment->version = TELEMETRY_VERSION;
+    segment->size = sizeof(TelemetrySegment);
+    segment->n_tasks = (uint32_t) n_tasks;
+    segment->pid = getpid();
+    snprintf(segment->description, sizeof(segment->description), "%s", description);
+    seqlock_init(&segment->state.lock);
+    TelemetryState state = { 0 };
+    SEQLOCK_PUBLISH(&segment->state, &state);
+    for (int i = 0; i < n_tasks; i++) {
+        TelemetryTask task = { 0 };
+        snprintf(segment->task_names[i], TELEMETRY_NAME_LEN, "%s", task_names[i]);
+        seqlock_init(&segment->tasks[i].lock);
+        SEQLOCK_PUBLISH(&segment->tasks[i], &task);
+    }
+    atomic_store(&segment->active, 1);
+    atomic_store_explicit(&segment->magic, TELEMETRY_MAGIC, memory_order_release);
+
+    telemetry->segment = segment;
+    telemetry->owner = 1;
+    snprintf(telemetry->name, sizeof(telemetry->name), "%s", name);
+    return telemetry;
+}
+
+// Implementação da publicação do estado.
+void telemetry_publish_state(Telemetry* telemetry, const TelemetryState* state) {
+    SEQLOCK_PUBLISH(&telemetry->segment->state, state);
+}
+
+// Implementação da publicação dos contadores de uma tarefa.
+void telemetry_publish_task(TelemetryTaskChannel* channel, const TelemetryTask* task) {
+    SEQLOCK_PUBLISH(channel, task);
+}
+
+// Implementação da abertura para leitura.
+Telemetry* open_telemetry(const char* name) {
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+        perror(name);
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size != sizeof(TelemetrySegment)) {
+        fprintf(stderr, "%s: segmento com tamanho inesperado (outra versão da simulação?).\n", name);
+        close(fd);
+        return NULL;
+    }
+    TelemetrySegment* segment = mmap(NULL, sizeof(TelemetrySegment), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (segment == MAP_FAILED) {
+        perror(name);
+        return NULL;
+    }
+    if (atomic_load_explicit(&segment->magic, memory_order_acquire) != TELEMETRY_MAGIC ||
+        segment->version != TELEMETRY_VERSION || segment->size != sizeof(TelemetrySegment) ||
+        segment->n_tasks < 1 || segment->n_tasks > TELEMETRY_MAX_TASKS) {
+        fprintf(stderr, "%s: não é um segmento de telemetria versão %d.\n", name, TELEMETRY_VERSION);
+        munmap(segment, sizeof(TelemetrySegment));
+        return NULL;
+    }
+
+    Telemetry* telemetry = calloc(1, sizeof(Telemetry));
+    if (telemetry == NULL) {
+        munmap(segment, sizeof(TelemetrySegment));
+        return NULL;
+    }
+    telemetry->segment = segment;
+    snprintf(telemetry->name, sizeof(telemetry->name), "%s", name);
+    return telemetry;
+}
+
+// Implementação da leitura do estado: o mapeamento é só de leitura, então as
+// tentativas não contam repetições no seqlock.
+void telemetry_read_state(const Telemetry* telemetry, TelemetryState* state) {
+    const TelemetryStateChannel* channel = &telemetry->segment->state;
+    while (seqlock_try_read(&channel->lock, channel->value, state, sizeof(channel->value[0])) != 0) {
+    }
+}
+
+// Implementação da leitura dos contadores de uma tarefa.
+void telemetry_read_task(const Telemetry* telemetry, int i, TelemetryTask* task) {
+    const TelemetryTaskChannel* channel = &telemetry->segment->tasks[i];
+    while (seqlock_try_read(&channel->lock, channel->value, task, sizeof(channel->value[0])) != 0) {
+    }
+}
+
+// Implementação da liberação.
+void free_telemetry(Telemetry* telemetry) {
+    if (telemetry == NULL) return;
+    if (telemetry->owner) {
+        atomic_store(&telemetry->segment->active, 0);
+        shm_unlink(telemetry->name);
+    }
+    munmap(telemetry->segment, sizeof(TelemetrySegment));
+    free(telemetry);
+}
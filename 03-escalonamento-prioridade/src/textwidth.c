@@ -0,0 +1,16 @@
+#include <string.h>
+#include "textwidth.h"
+
+// Implementação da largura exibida: bytes de continuação (10xxxxxx) não ocupam coluna.
+int text_display_width(const char* text) {
+    int width = 0;
+    for (const unsigned char* c = (const unsigned char*) text; *c != '\0'; c++) {
+        if ((*c & 0xC0) != 0x80) width++;
+    }
+    return width;
+}
+
+// Implementação da largura de campo.
+int text_field_width(const char* text, int width) {
+    return width + (int) strlen(text) - text_display_width(text);
+}
@@ -0,0 +1,63 @@
+#define _DEFAULT_SOURCE // Habilita clock_gettime
+
+#include <stdio.h>
+#include <time.h>
+#include "trace.h"
+#include "textwidth.h"
+
+// Implementação do relógio.
+uint64_t trace_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+// Implementação da limpeza do carimbo.
+void trace_stamp_clear(TraceStamp* stamp) {
+    for (int i = 0; i < TRACE_MAX_CHAINS; i++) stamp->origin_ns[i] = 0;
+}
+
+// Implementação da inicialização.
+void trace_chain_init(TraceChain* chain, const char* name, const char* path) {
+    chain->name = name;
+    chain->path = path;
+    histogram_init(&chain->age_ns);
+    histogram_init(&chain->reaction_ns);
+    chain->last_origin_ns = 0;
+}
+
+// Implementação do registro.
+void trace_observe(TraceChain* chain, uint64_t origin_ns, uint64_t now_ns) {
+    if (origin_ns == 0 || now_ns < origin_ns) return;
+    histogram_record(&chain->age_ns, now_ns - origin_ns);
+    if (origin_ns != chain->last_origin_ns) {
+        histogram_record(&chain->reaction_ns, now_ns - origin_ns);
+        chain->last_origin_ns = origin_ns;
+    }
+}
+
+// Uma linha da tabela: estatísticas de um histograma em ms. Nomes e métricas
+// acentuados ("Referência", "Reação") são alinhados pela largura exibida.
+static void print_row(const char* chain, const char* metric, const Histogram* h) {
+    printf("| %-*s | %-*s |", text_field_width(chain, 22), chain, text_field_width(metric, 7), metric);
+    if (h->count == 0) {
+        printf(" %8s | %10s | %10s | %10s | %10s |\n", "0", "-", "-", "-", "-");
+        return;
+    }
+    printf(" %8lu | %10.3f | %10.3f | %10.3f | %10.3f |\n", (unsigned long) h->count, h->min / 1e6,
+           histogram_mean(h) / 1e6, histogram_percentile(h, 99.0) / 1e6, h->max / 1e6);
+}
+
+// Implementação do relatório.
+void trace_print_chains(const TraceChain* chains, int n) {
+    printf("\n--- Latência de Causa e Efeito (idade do dado e reação, em ms) ---\n");
+    for (int i = 0; i < n; i++) {
+        printf("  %s: %s\n", chains[i].name, chains[i].path);
+    }
+    printf("| Cadeia                 | Métrica | Amostras |     Mínimo |      Média |        p99 |     Máximo |\n");
+    printf("|------------------------|---------|----------|------------|------------|------------|------------|\n");
+    for (int i = 0; i < n; i++) {
+        print_row(chains[i].name, "Idade", &chains[i].age_ns);
+        print_row(chains[i].name, "Reação", &chains[i].reaction_ns);
+    }
+}
@@ -0,0 +1,389 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "trajectory.h"
+
+// Distância abaixo da qual dois waypoints são considerados o mesmo ponto (m).
+#define WAYPOINT_EPS 1e-9
+// Iterações de Newton na inversão local do comprimento de arco.
+#define ARC_NEWTON_ITERATIONS 4
+// Passos lineares a partir do índice uniforme antes da busca binária.
+#define SEGMENT_SCAN_STEPS 4
+
+// Nós e pesos de Gauss-Legendre de 5 pontos em [-1, 1].
+static const double GL_X[5] = { -0.9061798459386640, -0.5384693101056831, 0.0,
+                                  0.5384693101056831,  0.9061798459386640 };
+static const double GL_W[5] = { 0.2369268850561891, 0.4786286704993665, 0.5688888888888889,
+                                0.4786286704993665, 0.2369268850561891 };
+
+// --- Funções Auxiliares ---
+
+// Resolve um sistema tridiagonal pelo algoritmo de Thomas (O(n)).
+// sub[i] multiplica x[i-1], diag[i] multiplica x[i], sup[i] multiplica x[i+1].
+// A solução é escrita em rhs; scratch precisa de n posições.
+static void solve_tridiagonal(const double* sub, const double* diag, const double* sup,
+                              double* rhs, double* scratch, int n) {
+    scratch[0] = sup[0] / diag[0];
+    rhs[0] = rhs[0] / diag[0];
+    for (int i = 1; i < n; i++) {
+        double m = diag[i] - sub[i] * scratch[i - 1];
+        scratch[i] = sup[i] / m;
+        rhs[i] = (rhs[i] - sub[i] * rhs[i - 1]) / m;
+    }
+    for (int i = n - 2; i >= 0; i--) {
+        rhs[i] -= scratch[i] * rhs[i + 1];
+    }
+}
+
+// Calcula as segundas derivadas M de uma coordenada (p) da spline.
+// Caminho aberto: spline natural (M nas pontas = 0).
+// Caminho fechado: spline periódica, resolvida com Sherman-Morrison, o que
+// mantém a continuidade C² também na emenda.
+static int solve_second_derivatives(const SplineTrajectory* traj, const double* p, double* m) {
+    int n = traj->n_points;
+    int segs = n - 1;
+    int size = traj->closed ? segs : n - 2; // Incógnitas do sistema
+    if (size <= 0) {
+        for (int i = 0; i < n; i++) m[i] = 0.0;
+        return 1;
+    }
+
+    double* sub = (double*) malloc(size * sizeof(double));
+    double* diag = (double*) malloc(size * sizeof(double));
+    double* sup = (double*) malloc(size * sizeof(double));
+    double* rhs = (double*) malloc(size * sizeof(double));
+    double* scratch = (double*) malloc(size * sizeof(double));
+    double* z = traj->closed ? (double*) malloc(size * sizeof(double)) : NULL;
+    if (sub == NULL || diag == NULL || sup == NULL || rhs == NULL || scratch == NULL ||
+        (traj->closed && z == NULL)) {
+        free(sub); free(diag); free(sup); free(rhs); free(scratch); free(z);
+        return 0;
+    }
+
+    // Equação do nó k: h_{k-1} M_{k-1} + 2(h_{k-1} + h_k) M_k + h_k M_{k+1} = 6 (s_k - s_{k-1}),
+    // com h_k o comprimento do segmento k e s_k a inclinação da corda.
+    for (int row = 0; row < size; row++) {
+        int k = traj->closed ? row : row + 1;
+        int prev = (k == 0) ? segs - 1 : k - 1; // No caminho fechado, o nó 0 fecha com o último segmento
+        double h_prev = traj->knot[prev + 1] - traj->knot[prev];
+        double h_next = traj->knot[k + 1] - traj->knot[k];
+        double p_prev = (k == 0) ? p[segs - 1] : p[k - 1];
+        sub[row] = h_prev;
+        diag[row] = 2.0 * (h_prev + h_next);
+        sup[row] = h_next;
+        rhs[row] = 6.0 * ((p[k + 1] - p[k]) / h_next - (p[k] - p_prev) / h_prev);
+    }
+
+    if (!traj->closed) {
+        sub[0] = 0.0;
+        sup[size - 1] = 0.0;
+        solve_tridiagonal(sub, diag, sup, rhs, scratch, size);
+        m[0] = 0.0;
+        m[n - 1] = 0.0;
+        for (int row = 0; row < size; row++) m[row + 1] = rhs[row];
+    } else {
+        // Sistema cíclico: os cantos (0, size-1) e (size-1, 0) são removidos por
+        // uma correção de posto 1 (Sherman-Morrison).
+        double beta = sub[0];           // A[0][size-1]
+        double alpha = sup[size - 1];   // A[size-1][0]
+        double gamma = -diag[0];
+        diag[0] -= gamma;
+        diag[size - 1] -= alpha * beta / gamma;
+        sub[0] = 0.0;
+        sup[size - 1] = 0.0;
+        for (int i = 0; i < size; i++) z[i] = 0.0;
+        z[0] = gamma;
+        z[size - 1] = alpha;
+        solve_tridiagonal(sub, diag, sup, rhs, scratch, size);
+        solve_tridiagonal(sub, diag, sup, z, scratch, size);
+        double fact = (rhs[0] + beta * rhs[size - 1] / gamma) / (1.0 + z[0] + beta * z[size - 1] / gamma);
+        for (int i = 0; i < size; i++) m[i] = rhs[i] - fact * z[i];
+        m[n - 1] = m[0];
+    }
+
+    free(sub); free(diag); free(sup); free(rhs); free(scratch); free(z);
+    return 1;
+}
+
+// Avalia posição e derivadas (em relação ao parâmetro de corda) no segmento i,
+// a uma distância tau do início do segmento.
+static void eval_segment(const SplineTrajectory* traj, int i, double tau,
+                         double pos[2], double d1[2], double d2[2]) {
+    double h = traj->knot[i + 1] - traj->knot[i];
+    double b = tau / h;
+    double a = 1.0 - b;
+    const double* px = traj->px;
+    const double* py = traj->py;
+    const double* mx = traj->mx;
+    const double* my = traj->my;
+
+    double ca = (a * a * a - a) * h * h / 6.0;
+    double cb = (b * b * b - b) * h * h / 6.0;
+    pos[0] = a * px[i] + b * px[i + 1] + ca * mx[i] + cb * mx[i + 1];
+    pos[1] = a * py[i] + b * py[i + 1] + ca * my[i] + cb * my[i + 1];
+
+    double da = (3.0 * a * a - 1.0) * h / 6.0;
+    double db = (3.0 * b * b - 1.0) * h / 6.0;
+    d1[0] = (px[i + 1] - px[i]) / h - da * mx[i] + db * mx[i + 1];
+    d1[1] = (py[i + 1] - py[i]) / h - da * my[i] + db * my[i + 1];
+
+    d2[0] = a * mx[i] + b * mx[i + 1];
+    d2[1] = a * my[i] + b * my[i + 1];
+}
+
+// Norma da derivada primeira (velocidade paramétrica) no segmento i.
+static double segment_speed(const SplineTrajectory* traj, int i, double tau) {
+    double pos[2], d1[2], d2[2];
+    eval_segment(traj, i, tau, pos, d1, d2);
+    return sqrt(d1[0] * d1[0] + d1[1] * d1[1]);
+}
+
+// Comprimento de arco do segmento i entre tau = 0 e tau = upper (Gauss-Legendre).
+static double segment_arc(const SplineTrajectory* traj, int i, double upper) {
+    double half = 0.5 * upper;
+    double sum = 0.0;
+    for (int k = 0; k < 5; k++) {
+        sum += GL_W[k] * segment_speed(traj, i, half * (GL_X[k] + 1.0));
+    }
+    return half * sum;
+}
+
+// Localiza o segmento que contém a distância s: o índice uniforme dá o primeiro
+// segmento da faixa e, em geral, alguns passos bastam. Uma faixa com muitos
+// segmentos curtos (waypoints concentrados) cai numa busca binária em arc[],
+// então o pior caso é O(log n), não O(n).
+static int find_segment(const SplineTrajectory* traj, double s) {
+    int segs = traj->n_points - 1;
+    int b = (int) (s * traj->bucket_inv);
+    if (b < 0) b = 0;
+    if (b >= traj->n_buckets) b = traj->n_buckets - 1;
+    int i = traj->bucket[b];
+    for (int step = 0; step < SEGMENT_SCAN_STEPS; step++) {
+        if (i >= segs - 1 || traj->arc[i + 1] >= s) return i;
+        i++;
+    }
+    // Último segmento i em [i, segs - 1] com arc[i] < s (ou o primeiro, se nenhum).
+    int lo = i, hi = segs - 1;
+    while (lo < hi) {
+        int mid = lo + (hi - lo + 1) / 2;
+        if (traj->arc[mid] < s) lo = mid; else hi = mid - 1;
+    }
+    return lo;
+}
+
+// --- Construção e Liberação ---
+
+void free_spline_trajectory(SplineTrajectory* traj) {
+    if (traj == NULL) return;
+    free(traj->knot);
+    free(traj->px);
+    free(traj->py);
+    free(traj->mx);
+    free(traj->my);
+    free(traj->arc);
+    free(traj->bucket);
+    free(traj);
+}
+
+SplineTrajectory* create_spline_trajectory(const double* x, const double* y, int n, double speed) {
+    if (x == NULL || y == NULL || n < 2 || speed <= 0.0) return NULL;
+
+    SplineTrajectory* traj = (SplineTrajectory*) calloc(1, sizeof(SplineTrajectory));
+    if (traj == NULL) return NULL;
+    traj->speed = speed;
+    traj->knot = (double*) malloc(n * sizeof(double));
+    traj->px = (double*) malloc(n * sizeof(double));
+    traj->py = (double*) malloc(n * sizeof(double));
+    traj->mx = (double*) malloc(n * sizeof(double));
+    traj->my = (double*) malloc(n * sizeof(double));
+    traj->arc = (double*) malloc(n * sizeof(double));
+    traj->bucket = (int*) malloc(n * sizeof(int));
+    if (traj->knot == NULL || traj->px == NULL || traj->py == NULL || traj->mx == NULL ||
+        traj->my == NULL || traj->arc == NULL || traj->bucket == NULL) {
+        free_spline_trajectory(traj);
+        return NULL;
+    }
+
+    // 1. Copia os waypoints descartando repetições e acumula a corda.
+    int count = 0;
+    for (int i = 0; i < n; i++) {
+        if (count > 0) {
+            double chord = hypot(x[i] - traj->px[count - 1], y[i] - traj->py[count - 1]);
+            if (chord < WAYPOINT_EPS) continue;
+            traj->knot[count] = traj->knot[count - 1] + chord;
+        } else {
+            traj->knot[0] = 0.0;
+        }
+        traj->px[count] = x[i];
+        traj->py[count] = y[i];
+        count++;
+    }
+    if (count < 2) {
+        free_spline_trajectory(traj);
+        return NULL;
+    }
+    traj->n_points = count;
+
+    // 2. Caminho fechado: o último waypoint coincide com o primeiro.
+    if (count >= 4 && hypot(traj->px[count - 1] - traj->px[0], traj->py[count - 1] - traj->py[0]) < 1e-6) {
+        traj->closed = 1;
+        traj->px[count - 1] = traj->px[0];
+        traj->py[count - 1] = traj->py[0];
+    }
+
+    // 3. Segundas derivadas nos nós (C² em todo o caminho).
+    if (!solve_second_derivatives(traj, traj->px, traj->mx) ||
+        !solve_second_derivatives(traj, traj->py, traj->my)) {
+        free_spline_trajectory(traj);
+        return NULL;
+    }
+
+    // 4. Tabela de comprimento de arco acumulado.
+    int segs = count - 1;
+    traj->arc[0] = 0.0;
+    for (int i = 0; i < segs; i++) {
+        traj->arc[i + 1] = traj->arc[i] + segment_arc(traj, i, traj->knot[i + 1] - traj->knot[i]);
+    }
+    traj->length = traj->arc[segs];
+
+    // 5. Índice uniforme de arco: uma faixa por segmento, em média.
+    traj->n_buckets = segs;
+    traj->bucket_inv = traj->n_buckets / traj->length;
+    int seg = 0;
+    for (int b = 0; b < traj->n_buckets; b++) {
+        double start = b / traj->bucket_inv;
+        while (seg < segs - 1 && traj->arc[seg + 1] < start) seg++;
+        traj->bucket[b] = seg;
+    }
+    return traj;
+}
+
+SplineTrajectory* load_spline_trajectory(const char* filename, double speed) {
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) {
+        perror("Erro ao abrir o arquivo de waypoints");
+        return NULL;
+    }
+
+    int capacity = 1024, n = 0;
+    double* x = (double*) malloc(capacity * sizeof(double));
+    double* y = (double*) malloc(capacity * sizeof(double));
+    char line[256];
+    int line_no = 0, ok = (x != NULL && y != NULL);
+
+    while (ok && fgets(line, sizeof(line), file) != NULL) {
+        line_no++;
+        char* comment = strchr(line, '#');
+        if (comment != NULL) *comment = '\0';
+
+        // Aceita espaço, tabulação ou vírgula como separador.
+        char* cursor = line;
+        while (*cursor == ' ' || *cursor == '\t') cursor++;
+        if (*cursor == '\0' || *cursor == '\n' || *cursor == '\r') continue;
+        char* end;
+        double vx = strtod(cursor, &end);
+        if (end == cursor) { ok = 0; break; }
+        cursor = end;
+        while (*cursor == ' ' || *cursor == '\t' || *cursor == ',') cursor++;
+        double vy = strtod(cursor, &end);
+        if (end == cursor) { ok = 0; break; }
+
+        if (n == capacity) {
+            capacity *= 2;
+            double* nx = (double*) realloc(x, capacity * sizeof(double));
+            double* ny = (double*) realloc(y, capacity * sizeof(double));
+            if (nx != NULL) x = nx;
+            if (ny != NULL) y = ny;
+            if (nx == NULL || ny == NULL) { ok = 0; break; }
+        }
+        x[n] = vx;
+        y[n] = vy;
+        n++;
+    }
+    fclose(file);
+
+    SplineTrajectory* traj = NULL;
+    if (!ok) {
+        fprintf(stderr, "Erro ao ler %s: linha %d inválida (esperado \"x y\").\n", filename, line_no);
+    } else {
+        traj = create_spline_trajectory(x, y, n, speed);
+        if (traj == NULL) fprintf(stderr, "Erro: %s precisa de ao menos 2 waypoints distintos.\n", filename);
+    }
+    free(x);
+    free(y);
+    return traj;
+}
+
+// --- Consultas ---
+
+void spline_sample_by_distance(const SplineTrajectory* traj, double s, ReferenceSample* out) {
+    if (s < 0.0) s = 0.0;
+    if (s > traj->length) s = traj->length;
+
+    // 1. Segmento em O(1) esperado.
+    int i = find_segment(traj, s);
+    double h = traj->knot[i + 1] - traj->knot[i];
+    double seg_len = traj->arc[i + 1] - traj->arc[i];
+    double target = s - traj->arc[i];
+
+    // 2. Inverte o comprimento de arco local por Newton, partindo da interpolação linear.
+    double tau = (seg_len > 0.0) ? h * target / seg_len : 0.0;
+    for (int k = 0; k < ARC_NEWTON_ITERATIONS; k++) {
+        double residual = segment_arc(traj, i, tau) - target;
+        if (fabs(residual) <= 1e-12 * (seg_len + 1.0)) break;
+        double speed_u = segment_speed(traj, i, tau);
+        if (speed_u <= 0.0) break;
+        tau -= residual / speed_u;
+        if (tau < 0.0) tau = 0.0;
+        if (tau > h) tau = h;
+    }
+
+    // 3. Converte as derivadas paramétricas em derivadas por comprimento de arco.
+    double pos[2], d1[2], d2[2];
+    eval_segment(traj, i, tau, pos, d1, d2);
+    double norm2 = d1[0] * d1[0] + d1[1] * d1[1];
+    double norm = sqrt(norm2);
+    double tx = d1[0] / norm, ty = d1[1] / norm;
+    double along = tx * d2[0] + ty * d2[1];
+
+    out->pos[0] = pos[0];
+    out->pos[1] = pos[1];
+    out->vel[0] = tx;
+    out->vel[1] = ty;
+    out->acc[0] = (d2[0] - along * tx) / norm2;
+    out->acc[1] = (d2[1] - along * ty) / norm2;
+}
+
+void spline_sample_by_time(const SplineTrajectory* traj, double t, ReferenceSample* out) {
+    double s = traj->speed * (t > 0.0 ? t : 0.0);
+
+    if (traj->closed) {
+        s = fmod(s, traj->length);
+    } else if (s >= traj->length) {
+        // Fim de um caminho aberto: o alvo para no último waypoint.
+        int last = traj->n_points - 1;
+        out->pos[0] = traj->px[last];
+        out->pos[1] = traj->py[last];
+        out->vel[0] = out->vel[1] = 0.0;
+        out->acc[0] = out->acc[1] = 0.0;
+        return;
+    }
+
+    spline_sample_by_distance(traj, s, out);
+    double v = traj->speed;
+    for (int k = 0; k < 2; k++) {
+        out->vel[k] *= v;
+        out->acc[k] *= v * v;
+    }
+}
+
+// Adaptador da spline para a assinatura genérica de amostragem.
+static void spline_sample(const void* source, double t, ReferenceSample* out) {
+    spline_sample_by_time((const SplineTrajectory*) source, t, out);
+}
+
+ReferenceSource spline_reference_source(const SplineTrajectory* traj) {
+    ReferenceSource src = { spline_sample, traj, "spline de waypoints" };
+    return src;
+}
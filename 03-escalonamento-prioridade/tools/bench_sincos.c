@@ -0,0 +1,162 @@
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <math.h>
+
+#include "fastmath.h"
+#include "robot.h" // Para M_PI
+
+// Benchmark e relatório de precisão do sincos fundido em relação à libm.
+// Uso: ./bench_sincos [n_elementos] [repeticoes]
+
+static volatile double g_sink; // Impede que o compilador descarte os resultados
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Preenche x com ângulos pseudoaleatórios em [-range, range].
+static void fill_angles(double* x, size_t n, double range, unsigned seed) {
+    srand(seed);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = range * (2.0 * rand() / (double) RAND_MAX - 1.0);
+    }
+}
+
+// --- Relatório de Precisão ---
+static void accuracy_report(const char* label, const double* x, size_t n) {
+    double max_err_s = 0, max_err_c = 0, sum_err = 0;
+    double worst_x = 0;
+    for (size_t i = 0; i < n; i++) {
+        double s, c;
+        fast_sincos_poly(x[i], &s, &c);
+        double es = fabs(s - sin(x[i]));
+        double ec = fabs(c - cos(x[i]));
+        if (es > max_err_s) { max_err_s = es; worst_x = x[i]; }
+        if (ec > max_err_c) max_err_c = ec;
+        sum_err += es + ec;
+    }
+    printf("| %-22s | %12.3e | %12.3e | %12.3e | %+14.6f |\n",
+           label, max_err_s, max_err_c, sum_err / (2.0 * n), worst_x);
+}
+
+// Confere se as versões em lote reproduzem bit a bit as versões escalares.
+static int batch_matches_scalar(const double* x, double* s, double* c, size_t n) {
+    int mismatches = 0;
+    fast_sincos_batch_poly(x, s, c, n);
+    for (size_t i = 0; i < n; i++) {
+        double rs, rc;
+        fast_sincos_poly(x[i], &rs, &rc);
+        if (rs != s[i] || rc != c[i]) mismatches++;
+    }
+    fast_sincos_batch_libm(x, s, c, n);
+    for (size_t i = 0; i < n; i++) {
+        if (s[i] != sin(x[i]) || c[i] != cos(x[i])) mismatches++;
+    }
+    return mismatches;
+}
+
+// --- Benchmark ---
+static void report_time(const char* label, double elapsed_ns, size_t total, double baseline_ns) {
+    double per_call = elapsed_ns / total;
+    printf("| %-28s | %10.2f | %8.2fx |\n", label, per_call, baseline_ns / per_call);
+}
+
+int main(int argc, char* argv[]) {
+    size_t n = (argc > 1) ? (size_t) atol(argv[1]) : 1u << 16;
+    int reps = (argc > 2) ? atoi(argv[2]) : 200;
+    if (n == 0 || reps <= 0) {
+        fprintf(stderr, "Uso: %s [n_elementos] [repeticoes]\n", argv[0]);
+        return 1;
+    }
+
+    double* x = malloc(n * sizeof(double));
+    double* s = malloc(n * sizeof(double));
+    double* c = malloc(n * sizeof(double));
+    if (x == NULL || s == NULL || c == NULL) {
+        fprintf(stderr, "Erro ao alocar os vetores de teste.\n");
+        return 1;
+    }
+
+    // 1. Precisão do polinômio contra a libm em faixas típicas e extremas.
+    printf("--- Precisão de fast_sincos_poly() contra sin()/cos() da libm ---\n");
+    printf("Limite teórico do erro absoluto: %.1e (|x| <= %.1e)\n\n",
+           FASTMATH_POLY_MAX_ERROR, FASTMATH_POLY_MAX_ARG);
+    printf("| Faixa                  |  Erro máx sin|  Erro máx cos|   Erro médio | x do pior sin  |\n");
+    printf("|------------------------|--------------|--------------|--------------|----------------|\n");
+    fill_angles(x, n, M_PI / 4, 1);
+    accuracy_report("[-pi/4, pi/4]", x, n);
+    fill_angles(x, n, 2 * M_PI, 2);
+    accuracy_report("[-2pi, 2pi]", x, n);
+    fill_angles(x, n, 1e3, 3);
+    accuracy_report("[-1e3, 1e3]", x, n);
+    fill_angles(x, n, FASTMATH_POLY_MAX_ARG, 4);
+    accuracy_report("[-max_arg, max_arg]", x, n);
+    fill_angles(x, n, 1e9, 5);
+    accuracy_report("[-1e9, 1e9] (fallback)", x, n);
+
+    fill_angles(x, n, 100.0, 6);
+    int mismatches = batch_matches_scalar(x, s, c, n);
+    printf("\nLote vs escalar: %d divergências em %zu elementos.\n", mismatches, 2 * n);
+
+    // 2. Tempo por par (seno, cosseno) em cada implementação.
+    fill_angles(x, n, 2 * M_PI, 7);
+    size_t total = n * (size_t) reps;
+    double acc = 0, t0, baseline;
+
+    printf("\n--- Tempo por par seno/cosseno (%zu elementos x %d repetições) ---\n", n, reps);
+    printf("| Implementação                |   ns/par   | Speedup   |\n");
+    printf("|------------------------------|------------|-----------|\n");
+
+    t0 = now_ns();
+    for (int r = 0; r < reps; r++) {
+        for (size_t i = 0; i < n; i++) acc += sin(x[i]) + cos(x[i]);
+    }
+    baseline = (now_ns() - t0) / total;
+    report_time("sin() + cos() separados", baseline * total, total, baseline);
+
+    t0 = now_ns();
+    for (int r = 0; r < reps; r++) {
+        for (size_t i = 0; i < n; i++) {
+            double sv, cv;
+            fast_sincos_libm(x[i], &sv, &cv);
+            acc += sv + cv;
+        }
+    }
+    report_time("fast_sincos_libm", now_ns() - t0, total, baseline);
+
+    t0 = now_ns();
+    for (int r = 0; r < reps; r++) {
+        for (size_t i = 0; i < n; i++) {
+            double sv, cv;
+            fast_sincos_poly(x[i], &sv, &cv);
+            acc += sv + cv;
+        }
+    }
+    report_time("fast_sincos_poly", now_ns() - t0, total, baseline);
+
+    t0 = now_ns();
+    for (int r = 0; r < reps; r++) {
+        fast_sincos_batch_libm(x, s, c, n);
+        acc += s[n - 1] + c[n - 1];
+    }
+    report_time("fast_sincos_batch_libm", now_ns() - t0, total, baseline);
+
+    t0 = now_ns();
+    for (int r = 0; r < reps; r++) {
+        fast_sincos_batch_poly(x, s, c, n);
+        acc += s[n - 1] + c[n - 1];
+    }
+    report_time("fast_sincos_batch_poly", now_ns() - t0, total, baseline);
+    printf("--------------------------------------------------------\n");
+
+    g_sink = acc;
+    free(x);
+    free(s);
+    free(c);
+    return mismatches == 0 ? 0 : 1;
+}
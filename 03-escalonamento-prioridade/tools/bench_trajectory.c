@@ -0,0 +1,95 @@
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <math.h>
+
+#include "trajectory.h"
+#include "robot.h" // Para M_PI
+
+// Benchmark da spline de waypoints: tempo de construção e custo das consultas
+// num caminho sintético (circunferência) com muitos waypoints.
+// Uso: ./bench_trajectory [n_waypoints] [n_consultas]
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(int argc, char* argv[]) {
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int queries = (argc > 2) ? atoi(argv[2]) : 1000000;
+    if (n < 4 || queries <= 0) {
+        fprintf(stderr, "Uso: %s [n_waypoints >= 4] [n_consultas]\n", argv[0]);
+        return 1;
+    }
+
+    // 1. Circunferência fechada de raio R: a resposta exata é conhecida.
+    const double radius = 1000.0;
+    const double speed = 1.0;
+    double* x = malloc(n * sizeof(double));
+    double* y = malloc(n * sizeof(double));
+    if (x == NULL || y == NULL) {
+        fprintf(stderr, "Erro ao alocar os waypoints.\n");
+        return 1;
+    }
+    for (int i = 0; i < n; i++) {
+        double a = 2.0 * M_PI * i / (n - 1);
+        x[i] = radius * cos(a);
+        y[i] = radius * sin(a);
+    }
+
+    double t0 = now_ns();
+    SplineTrajectory* traj = create_spline_trajectory(x, y, n, speed);
+    double build_ms = (now_ns() - t0) / 1e6;
+    free(x);
+    free(y);
+    if (traj == NULL) {
+        fprintf(stderr, "Erro ao construir a spline.\n");
+        return 1;
+    }
+
+    printf("--- Spline de %d waypoints (circunferência de raio %.0f m) ---\n", n, radius);
+    printf("  - Construção:        %10.2f ms\n", build_ms);
+    printf("  - Comprimento:       %10.4f m (exato: %.4f m)\n", traj->length, 2.0 * M_PI * radius);
+    printf("  - Caminho fechado:   %10s\n", traj->closed ? "sim" : "não");
+
+    // 2. Consultas por tempo em sequência (padrão de uso da malha de controle).
+    double horizon = traj->length / speed;
+    double max_pos_err = 0, max_speed_err = 0, max_query_ns = 0;
+    ReferenceSample sample;
+    t0 = now_ns();
+    for (int q = 0; q < queries; q++) {
+        spline_sample_by_time(traj, horizon * q / queries, &sample);
+    }
+    double seq_ns = (now_ns() - t0) / queries;
+
+    // 3. Consultas por distância aleatórias, com erro e pior latência individual.
+    srand(1);
+    t0 = now_ns();
+    for (int q = 0; q < queries; q++) {
+        double s = traj->length * rand() / (double) RAND_MAX;
+        double q0 = now_ns();
+        spline_sample_by_distance(traj, s, &sample);
+        double dq = now_ns() - q0;
+        if (dq > max_query_ns) max_query_ns = dq;
+
+        double a = s / radius;
+        double err = hypot(sample.pos[0] - radius * cos(a), sample.pos[1] - radius * sin(a));
+        if (err > max_pos_err) max_pos_err = err;
+        double tangent_err = fabs(hypot(sample.vel[0], sample.vel[1]) - 1.0);
+        if (tangent_err > max_speed_err) max_speed_err = tangent_err;
+    }
+    double rand_ns = (now_ns() - t0) / queries;
+
+    printf("  - Consulta por tempo (sequencial):    %8.1f ns\n", seq_ns);
+    printf("  - Consulta por distância (aleatória): %8.1f ns (inclui medição)\n", rand_ns);
+    printf("  - Pior consulta individual:           %8.1f ns\n", max_query_ns);
+    printf("  - Erro máx. de posição:  %.3e m\n", max_pos_err);
+    printf("  - Erro máx. de |dr/ds|:  %.3e\n", max_speed_err);
+
+    free_spline_trajectory(traj);
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "binlog.h"
+
+// Conversor do log binário (binlog.h) para CSV ou para o texto antigo.
+// O arquivo é mapeado (mmap): abrir custa o mesmo para qualquer duração de
+// execução, e --de usa o índice para começar direto no registro certo.
+// Uso: ./log2csv <log.bin> [--texto] [--info] [--de t0] [--ate t1] > saida.csv
+//   --texto  Linhas "%f" separadas por espaço, com "# <descrição>" e o cabeçalho
+//            das colunas (o formato lido pelas versões antigas de plot_lab3.m).
+//   --info   Só o cabeçalho: versão, descrição, colunas, registros e índice.
+
+static void print_usage(const char* program) {
+    fprintf(stderr, "Uso: %s <log.bin> [--texto] [--info] [--de t0] [--ate t1]\n", program);
+}
+
+int main(int argc, char* argv[]) {
+    const char* filename = NULL;
+    int text = 0, info = 0;
+    double t_from = -INFINITY, t_to = INFINITY;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--texto") == 0) {
+            text = 1;
+        } else if (strcmp(argv[i], "--info") == 0) {
+            info = 1;
+        } else if (strcmp(argv[i], "--de") == 0 && i + 1 < argc) {
+            t_from = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--ate") == 0 && i + 1 < argc) {
+            t_to = atof(argv[++i]);
+        } else if (filename == NULL && argv[i][0] != '-') {
+            filename = argv[i];
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (filename == NULL) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    BinLogReader* reader = open_binlog_reader(filename);
+    if (reader == NULL) return 1;
+    const BinLogHeader* header = reader->header;
+    int n_columns = (int) header->n_columns;
+
+    if (info) {
+        printf("Arquivo:    %s (versão %u)\n", filename, header->version);
+        printf("Descrição:  %.*s\n", BINLOG_TEXT_LEN, header->description);
+        printf("Colunas:   ");
+        for (int c = 0; c < n_columns; c++) printf(" %.*s", BINLOG_NAME_LEN, reader->columns[c]);
+        printf("\nRegistros:  %lu de %u bytes\n", (unsigned long) reader->n_records, header->record_size);
+        if (reader->index != NULL) {
+            printf("Índice:     %lu entradas (uma a cada %lu registros)\n", (unsigned long) reader->n_index,
+                   (unsigned long) header->index_stride);
+        } else {
+            printf("Índice:     ausente (execução interrompida antes de fechar o log)\n");
+        }
+        if (reader->n_records > 0) {
+            printf("Tempo:      %.3f a %.3f s\n", binlog_record(reader, 0)[0],
+                   binlog_record(reader, reader->n_records - 1)[0]);
+        }
+        free_binlog_reader(reader);
+        return 0;
+    }
+
+    // Cabeçalho da saída.
+    if (text) printf("# %.*s\n", BINLOG_TEXT_LEN, header->description);
+    for (int c = 0; c < n_columns; c++) {
+        printf(c == 0 ? "%.*s" : (text ? " %.*s" : ",%.*s"), BINLOG_NAME_LEN, reader->columns[c]);
+    }
+    printf("\n");
+
+    // Registros da janela [t_from, t_to].
+    uint64_t first = isinf(t_from) ? 0 : binlog_seek_time(reader, t_from);
+    for (uint64_t i = first; i < reader->n_records; i++) {
+        const double* record = binlog_record(reader, i);
+        if (record[0] > t_to) break;
+        for (int c = 0; c < n_columns; c++) {
+            if (text) {
+                printf(c == 0 ? "%f" : " %f", record[c]);
+            } else {
+                printf(c == 0 ? "%.17g" : ",%.17g", record[c]);
+            }
+        }
+        printf("\n");
+    }
+
+    free_binlog_reader(reader);
+    return 0;
+}
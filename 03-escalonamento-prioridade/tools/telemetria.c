@@ -0,0 +1,99 @@
+#define _DEFAULT_SOURCE // Habilita usleep
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+
+#include "telemetry.h"
+#include "textwidth.h"
+
+// Monitor de referência da telemetria (telemetry.h): conecta-se ao segmento de
+// uma simulação em andamento (./main --telemetria) e mostra o estado e os
+// tempos de cada tarefa. As leituras são cópias da memória mapeada, sem chamadas
+// de sistema e sem tocar nos mutexes da simulação; só a espera entre quadros
+// dorme.
+// Uso: ./telemetria [--nome /segmento] [--intervalo ms] [--uma]
+//   --intervalo  Tempo entre quadros (padrão 500 ms).
+//   --uma        Imprime um único quadro e sai.
+
+#define DEFAULT_INTERVAL_MS 500
+
+static void print_usage(const char* program) {
+    fprintf(stderr, "Uso: %s [--nome /segmento] [--intervalo ms] [--uma]\n", program);
+}
+
+// Imprime um quadro com o estado e os contadores publicados mais recentes.
+static void print_frame(const Telemetry* telemetry, int frame) {
+    const TelemetrySegment* segment = telemetry->segment;
+    TelemetryState state;
+    telemetry_read_state(telemetry, &state);
+    printf("--- Telemetria %s (pid %ld, quadro %d)%s ---\n", telemetry->name, (long) segment->pid, frame,
+           atomic_load(&segment->active) ? "" : " [ENCERRADA]");
+    printf("%.*s\n", TELEMETRY_TEXT_LEN, segment->description);
+    printf("Tempo: %.2f s%s\n", state.t, state.paused ? "  [PAUSADA]" : "");
+    printf("  Robô:       Xc %+7.3f m  Yc %+7.3f m  theta %+7.3f rad\n", state.x[0], state.x[1], state.x[2]);
+    printf("  Referência: X  %+7.3f m  Y  %+7.3f m\n", state.ref_xy[0], state.ref_xy[1]);
+    printf("  Ganhos:     alpha1 %.2f  alpha2 %.2f (versão %lu)\n", state.alpha[0], state.alpha[1],
+           (unsigned long) state.gains_version);
+    printf("| Tarefa         | T [ms] |   Jobs | Perdas | Descart. | Ci últ. [ms] | Ci máx [ms] | Ri máx [ms] | |J| máx [ms] |\n");
+    printf("|----------------|--------|--------|--------|----------|--------------|-------------|-------------|-------------|\n");
+    for (int i = 0; i < (int) segment->n_tasks; i++) {
+        TelemetryTask task;
+        telemetry_read_task(telemetry, i, &task);
+        char name[TELEMETRY_NAME_LEN + 1];
+        snprintf(name, sizeof(name), "%.*s", TELEMETRY_NAME_LEN, segment->task_names[i]);
+        printf("| %-*s | %6.0f | %6lu | %6lu | %8lu | %12.4f | %11.4f | %11.4f | %11.4f |\n",
+               text_field_width(name, 14), name, task.period_ms, (unsigned long) task.jobs,
+               (unsigned long) task.deadline_misses, (unsigned long) task.skipped_jobs, task.last_computation_ms,
+               task.max_computation_ms, task.max_response_ms, task.max_jitter_ms);
+    }
+    fflush(stdout);
+}
+
+int main(int argc, char* argv[]) {
+    const char* name = TELEMETRY_DEFAULT_NAME;
+    int interval_ms = DEFAULT_INTERVAL_MS;
+    int once = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--nome") == 0 && i + 1 < argc) {
+            name = argv[++i];
+        } else if (strcmp(argv[i], "--intervalo") == 0 && i + 1 < argc) {
+            interval_ms = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--uma") == 0) {
+            once = 1;
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (interval_ms <= 0) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    Telemetry* telemetry = open_telemetry(name);
+    if (telemetry == NULL) {
+        fprintf(stderr, "Inicie a simulação com ./main --telemetria.\n");
+        return 1;
+    }
+
+    // Num terminal cada quadro substitui o anterior; redirecionado, os quadros se acumulam.
+    int tty = isatty(STDOUT_FILENO);
+    for (int frame = 1;; frame++) {
+        if (tty && !once) printf("\033[H\033[J");
+        print_frame(telemetry, frame);
+        // Fim da execução: o último quadro já mostra os valores finais.
+        if (once || !atomic_load(&telemetry->segment->active)) break;
+        if (kill((pid_t) telemetry->segment->pid, 0) != 0) {
+            printf("Processo da simulação não existe mais.\n");
+            break;
+        }
+        usleep((useconds_t) interval_ms * 1000);
+        if (!tty) printf("\n");
+    }
+
+    free_telemetry(telemetry);
+    return 0;
+}
@@ -0,0 +1,222 @@
+#define _DEFAULT_SOURCE // Habilita madvise
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/mman.h>
+
+#include "binlog.h"
+#include "robot.h"
+
+// Analisador do erro de rastreamento de um log da UI (binlog.h), em uma única
+// passada e memória constante: substitui o recálculo da frente do robô em
+// scripts/plot_lab3.m e não precisa do Octave. O erro é a distância entre a
+// frente do robô (Xc + R cos theta, Yc + R sin theta) e a referência gravada.
+// Uso: ./tracking_error <log.bin> [--raio R] [--segmento s] [--de t0] [--ate t1]
+//                       [--serie saida.csv] [--passo s]
+//   --segmento  Duração de cada trecho da tabela por segmento (padrão 1 s).
+//   --serie     Grava a série reduzida para gráficos: uma linha por intervalo de
+//               --passo segundos (padrão 0.1), com o erro máximo do intervalo.
+
+#define DEFAULT_SEGMENT_S 1.0
+#define DEFAULT_STEP_S 0.1
+#define TIME_EPS 1e-6 // Os tempos do log são somas de períodos: 1.0 pode ser gravado como 0.9999999
+
+// Acumuladores de um trecho (ou da execução inteira). As integrais usam a regra
+// do trapézio entre amostras consecutivas; o intervalo pertence ao trecho da
+// amostra que o fecha.
+typedef struct {
+    long n;
+    double t_first, t_last;
+    double sum_e, sum_e2;
+    double max_e, t_max;
+    double iae, ise, itae; // ∫|e| dt, ∫e² dt, ∫(t - t0)|e| dt
+} ErrorStats;
+
+// Amostra da série reduzida: a primeira do intervalo, mais o pior erro dele.
+typedef struct {
+    long bucket;
+    double t, xf, yf, xref, yref, e, max_e;
+} SeriesPoint;
+
+static void print_usage(const char* program) {
+    fprintf(stderr, "Uso: %s <log.bin> [--raio R] [--segmento s] [--de t0] [--ate t1] [--serie saida.csv] [--passo s]\n",
+            program);
+}
+
+static void stats_reset(ErrorStats* st) {
+    memset(st, 0, sizeof(*st));
+}
+
+// Acumula a amostra (t, e); prev_t/prev_e são a amostra anterior da análise (has_prev = 0 na primeira).
+static void stats_add(ErrorStats* st, double t, double e, int has_prev, double prev_t, double prev_e, double t0) {
+    if (st->n == 0) st->t_first = t;
+    st->n++;
+    st->t_last = t;
+    st->sum_e += e;
+    st->sum_e2 += e * e;
+    if (e > st->max_e || st->n == 1) {
+        st->max_e = e;
+        st->t_max = t;
+    }
+    if (has_prev && t > prev_t) {
+        double dt = t - prev_t;
+        st->iae += 0.5 * (e + prev_e) * dt;
+        st->ise += 0.5 * (e * e + prev_e * prev_e) * dt;
+        st->itae += 0.5 * ((t - t0) * e + (prev_t - t0) * prev_e) * dt;
+    }
+}
+
+static void print_segment(const ErrorStats* st) {
+    if (st->n == 0) return;
+    printf("| %6.2f - %6.2f | %8ld | %14.6f | %10.6f | %11.6f | %9.6f |\n", st->t_first, st->t_last, st->n,
+           st->sum_e / st->n, sqrt(st->sum_e2 / st->n), st->max_e, st->iae);
+}
+
+static void write_point(FILE* f, const SeriesPoint* p) {
+    fprintf(f, "%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f\n", p->t, p->xf, p->yf, p->xref, p->yref, p->e, p->max_e);
+}
+
+// Índice da coluna pelo nome gravado no cabeçalho (-1 se ausente).
+static int find_column(const BinLogReader* reader, const char* name) {
+    for (int c = 0; c < (int) reader->header->n_columns; c++) {
+        if (strncmp(reader->columns[c], name, BINLOG_NAME_LEN) == 0) return c;
+    }
+    return -1;
+}
+
+int main(int argc, char* argv[]) {
+    const char* filename = NULL;
+    const char* series_filename = NULL;
+    double radius = ROBOT_DIAMETER / 2.0;
+    double segment_s = DEFAULT_SEGMENT_S, step_s = DEFAULT_STEP_S;
+    double t_from = -INFINITY, t_to = INFINITY;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--raio") == 0 && i + 1 < argc) {
+            radius = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--segmento") == 0 && i + 1 < argc) {
+            segment_s = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--passo") == 0 && i + 1 < argc) {
+            step_s = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--serie") == 0 && i + 1 < argc) {
+            series_filename = argv[++i];
+        } else if (strcmp(argv[i], "--de") == 0 && i + 1 < argc) {
+            t_from = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--ate") == 0 && i + 1 < argc) {
+            t_to = atof(argv[++i]);
+        } else if (filename == NULL && argv[i][0] != '-') {
+            filename = argv[i];
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (filename == NULL || segment_s <= 0.0 || step_s <= 0.0) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    BinLogReader* reader = open_binlog_reader(filename);
+    if (reader == NULL) return 1;
+    static const char* const names[] = { "Xc(m)", "Yc(m)", "theta(rad)", "Xref(m)", "Yref(m)" };
+    enum { COL_XC, COL_YC, COL_THETA, COL_XREF, COL_YREF, NUM_COLS };
+    int col[NUM_COLS];
+    for (int k = 0; k < NUM_COLS; k++) {
+        col[k] = find_column(reader, names[k]);
+        if (col[k] < 0) {
+            fprintf(stderr, "%s: coluna %s ausente (use o log principal da UI).\n", filename, names[k]);
+            free_binlog_reader(reader);
+            return 1;
+        }
+    }
+
+    FILE* series = NULL;
+    if (series_filename != NULL) {
+        series = fopen(series_filename, "w");
+        if (series == NULL) {
+            perror("Erro ao criar a série");
+            free_binlog_reader(reader);
+            return 1;
+        }
+        fprintf(series, "t(s),Xf(m),Yf(m),Xref(m),Yref(m),erro(m),erro_max(m)\n");
+    }
+
+    // Leitura em ordem: o kernel pode ler adiante e descartar as páginas já usadas.
+    madvise((void*) reader->map, reader->map_size, MADV_SEQUENTIAL);
+
+    printf("Log: %s (%.*s)\n", filename, BINLOG_TEXT_LEN, reader->header->description);
+    printf("Erro de rastreamento da frente do robô (R = %.3f m), trechos de %.2f s:\n", radius, segment_s);
+    printf("| Trecho [s]      | Amostras | Erro médio [m] | RMS [m]    | Máximo [m]  | IAE [m·s] |\n");
+    printf("|-----------------|----------|----------------|------------|-------------|-----------|\n");
+
+    ErrorStats total, segment;
+    SeriesPoint point = { -1, 0, 0, 0, 0, 0, 0, 0 };
+    stats_reset(&total);
+    stats_reset(&segment);
+    long current_segment = -1, skipped = 0;
+    double prev_t = 0.0, prev_e = 0.0, t0 = 0.0;
+    uint64_t first = isinf(t_from) ? 0 : binlog_seek_time(reader, t_from - TIME_EPS);
+    for (uint64_t i = first; i < reader->n_records; i++) {
+        const double* r = binlog_record(reader, i);
+        double t = r[0];
+        if (t > t_to + TIME_EPS) break;
+        double theta = r[col[COL_THETA]];
+        double xf = r[col[COL_XC]] + radius * cos(theta);
+        double yf = r[col[COL_YC]] + radius * sin(theta);
+        double ex = xf - r[col[COL_XREF]], ey = yf - r[col[COL_YREF]];
+        double e = sqrt(ex * ex + ey * ey);
+        if (!isfinite(e) || !isfinite(t)) {
+            skipped++;
+            continue;
+        }
+        int has_prev = total.n > 0;
+        if (!has_prev) t0 = t;
+
+        // Trecho e intervalo da série contados a partir da primeira amostra analisada.
+        long seg = (long) floor((t - t0) / segment_s + TIME_EPS);
+        if (seg != current_segment) {
+            print_segment(&segment);
+            stats_reset(&segment);
+            current_segment = seg;
+        }
+        stats_add(&segment, t, e, has_prev, prev_t, prev_e, t0);
+        stats_add(&total, t, e, has_prev, prev_t, prev_e, t0);
+
+        if (series != NULL) {
+            long bucket = (long) floor((t - t0) / step_s + TIME_EPS);
+            if (bucket != point.bucket) {
+                if (point.bucket >= 0) write_point(series, &point);
+                point = (SeriesPoint) { bucket, t, xf, yf, r[col[COL_XREF]], r[col[COL_YREF]], e, e };
+            } else if (e > point.max_e) {
+                point.max_e = e;
+            }
+        }
+        prev_t = t;
+        prev_e = e;
+    }
+    print_segment(&segment);
+    if (series != NULL) {
+        if (point.bucket >= 0) write_point(series, &point);
+        fclose(series);
+    }
+
+    if (total.n == 0) {
+        printf("  Nenhuma amostra no intervalo pedido.\n");
+        free_binlog_reader(reader);
+        return 1;
+    }
+    printf("\n--- Erro de Rastreamento: %.2f a %.2f s ---\n", total.t_first, total.t_last);
+    printf("  - Amostras:          %ld%s\n", total.n, skipped ? " (com valores inválidos descartados)" : "");
+    printf("  - Erro médio:        %f m\n", total.sum_e / total.n);
+    printf("  - Erro RMS:          %f m\n", sqrt(total.sum_e2 / total.n));
+    printf("  - Desvio máximo:     %f m (t = %.2f s)\n", total.max_e, total.t_max);
+    printf("  - Erro final:        %f m\n", prev_e);
+    printf("  - IAE  = ∫|e| dt:    %f m·s\n", total.iae);
+    printf("  - ISE  = ∫e² dt:     %f m²·s\n", total.ise);
+    printf("  - ITAE = ∫t|e| dt:   %f m·s²\n", total.itae);
+    if (series_filename != NULL) printf("Série reduzida (passo %.3f s) salva em %s\n", step_s, series_filename);
+
+    free_binlog_reader(reader);
+    return 0;
+}
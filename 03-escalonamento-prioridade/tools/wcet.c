@@ -0,0 +1,222 @@
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "robot.h"
+#include "control.h"
+#include "ref_model.h"
+#include "reference.h"
+#include "histogram.h"
+
+// Medição de WCET dos corpos das tarefas, isolados do resto do sistema: cada
+// corpo roda milhões de vezes com a cache quente e milhares de vezes com a
+// cache de dados esvaziada antes de cada chamada. O resultado é o histograma
+// completo de cada corpo (em CSV) e os percentis altos como estimativa de WCET.
+// Uso: ./wcet [iteracoes_quentes] [iteracoes_frias] [arquivo_csv]
+// Para reduzir a interferência do sistema: sudo chrt -f 80 ./wcet
+
+#define WARMUP_ITERATIONS 10000
+#define FLUSH_MAX_BYTES (32u << 20) // Teto do buffer de despejo (L3 muito grandes)
+#define FLUSH_FALLBACK_BYTES (8u << 20)
+#define CACHE_LINE 64
+
+static volatile double g_sink; // Impede que o compilador descarte os resultados
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+// --- Estado Compartilhado pelos Corpos ---
+// Os mesmos objetos que as tarefas usam em main.c, evoluindo a cada chamada.
+typedef struct {
+    RobotState* robot;
+    Controller* controller;
+    RefModel* ref_model;
+    ReferenceTrajectory* reference;
+    ReferenceTable* table;
+    double alpha1, alpha2;
+    double t;
+} Fixture;
+
+typedef struct {
+    const char* name;
+    void (*run)(Fixture* fx);
+} WcetBody;
+
+static void run_update_state(Fixture* fx) {
+    fx->robot->u->data[0][0] = 0.5;
+    fx->robot->u->data[1][0] = 0.3;
+    update_state(fx->robot, 0.030);
+    calculate_output_y(fx->robot);
+}
+
+static void run_linearization(Fixture* fx) {
+    calculate_linearization_u(fx->controller, fx->robot);
+}
+
+static void run_controller(Fixture* fx) {
+    calculate_controller_output_v(fx->controller, fx->robot, fx->ref_model);
+}
+
+static void run_ref_model(Fixture* fx) {
+    update_ref_model(fx->ref_model, fx->reference, 0.050);
+}
+
+static void run_reference(Fixture* fx) {
+    fx->t += 0.120;
+    calculate_reference(fx->reference, fx->t);
+}
+
+static void run_reference_table(Fixture* fx) {
+    fx->t = fmod(fx->t + 0.050, REFERENCE_TABLE_HORIZON);
+    reference_table_fill(fx->table, fx->reference, fx->t);
+}
+
+static const WcetBody g_bodies[] = {
+    { "update_state + y", run_update_state },
+    { "calculate_linearization_u", run_linearization },
+    { "calculate_controller_output_v", run_controller },
+    { "update_ref_model", run_ref_model },
+    { "calculate_reference", run_reference },
+    { "reference_table_fill", run_reference_table },
+};
+#define NUM_BODIES ((int) (sizeof(g_bodies) / sizeof(g_bodies[0])))
+
+// --- Despejo da Cache ---
+// Percorrer um buffer maior que a última cache expulsa os dados dos corpos de
+// L1/L2/L3. O buffer é limitado a FLUSH_MAX_BYTES: em CPUs com L3 maior que
+// isso o modo frio esvazia L1/L2 e só parte da L3.
+static unsigned char* g_flush_buffer;
+static size_t g_flush_bytes;
+
+static size_t last_level_cache_bytes(void) {
+    long size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (size <= 0) size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    return size > 0 ? (size_t) size : FLUSH_FALLBACK_BYTES;
+}
+
+static void flush_cache(void) {
+    double sum = 0;
+    for (size_t i = 0; i < g_flush_bytes; i += CACHE_LINE) {
+        g_flush_buffer[i]++;
+        sum += g_flush_buffer[i];
+    }
+    g_sink = sum;
+}
+
+// Menor custo de um par de leituras do relógio, descontado de cada amostra.
+static uint64_t clock_overhead_ns(void) {
+    uint64_t best = UINT64_MAX;
+    for (int i = 0; i < 100000; i++) {
+        uint64_t t0 = now_ns();
+        uint64_t t1 = now_ns();
+        if (t1 - t0 < best) best = t1 - t0;
+    }
+    return best;
+}
+
+static void measure(const WcetBody* body, Fixture* fx, long iterations, int cold, uint64_t overhead_ns, Histogram* hist) {
+    histogram_init(hist);
+    if (!cold) {
+        for (int i = 0; i < WARMUP_ITERATIONS; i++) body->run(fx);
+    }
+    for (long i = 0; i < iterations; i++) {
+        if (cold) flush_cache();
+        uint64_t t0 = now_ns();
+        body->run(fx);
+        uint64_t elapsed = now_ns() - t0;
+        histogram_record(hist, elapsed > overhead_ns ? elapsed - overhead_ns : 0);
+    }
+}
+
+static void print_row(const char* name, const char* mode, const Histogram* h) {
+    printf("| %-29s | %-6s | %9lu | %7lu | %8.1f | %7lu | %7lu | %7lu | %7lu | %8lu |\n", name, mode,
+           (unsigned long) h->count, (unsigned long) h->min, histogram_mean(h),
+           (unsigned long) histogram_percentile(h, 50.0), (unsigned long) histogram_percentile(h, 99.0),
+           (unsigned long) histogram_percentile(h, 99.9), (unsigned long) histogram_percentile(h, 99.99),
+           (unsigned long) h->max);
+}
+
+// Uma linha por faixa não vazia: corpo, cache, início e fim da faixa (ns), contagem.
+static void export_histogram(FILE* file, const char* name, const char* mode, const Histogram* h) {
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        if (h->counts[i] == 0) continue;
+        fprintf(file, "%s,%s,%lu,%lu,%u\n", name, mode, (unsigned long) histogram_bucket_lower(i),
+                (unsigned long) histogram_bucket_upper(i), h->counts[i]);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    long warm_iterations = (argc > 1) ? atol(argv[1]) : 2000000;
+    long cold_iterations = (argc > 2) ? atol(argv[2]) : 1000;
+    const char* csv_filename = (argc > 3) ? argv[3] : "wcet_histogramas.csv";
+    if (warm_iterations <= 0 || cold_iterations <= 0) {
+        fprintf(stderr, "Uso: %s [iteracoes_quentes] [iteracoes_frias] [arquivo_csv]\n", argv[0]);
+        return 1;
+    }
+
+    // 1. Os mesmos objetos da simulação, com os ganhos padrão.
+    Fixture fx = { 0 };
+    fx.alpha1 = fx.alpha2 = 2.0;
+    fx.robot = create_robot_state();
+    fx.controller = create_controller(&fx.alpha1, &fx.alpha2);
+    fx.ref_model = create_ref_model(fx.alpha1, fx.alpha2);
+    fx.reference = create_reference_trajectory();
+    fx.table = create_reference_table(REFERENCE_TABLE_STEP, REFERENCE_TABLE_HORIZON);
+    size_t llc = last_level_cache_bytes();
+    g_flush_bytes = 2 * llc < FLUSH_MAX_BYTES ? 2 * llc : FLUSH_MAX_BYTES;
+    g_flush_buffer = calloc(g_flush_bytes, 1);
+    FILE* csv = fopen(csv_filename, "w");
+    if (fx.robot == NULL || fx.controller == NULL || fx.ref_model == NULL || fx.reference == NULL ||
+        fx.table == NULL || g_flush_buffer == NULL || csv == NULL) {
+        fprintf(stderr, "Erro ao preparar a medição (memória ou arquivo %s).\n", csv_filename);
+        return 1;
+    }
+    calculate_reference(fx.reference, 0.0);
+
+    uint64_t overhead_ns = clock_overhead_ns();
+    printf("--- WCET dos Corpos das Tarefas (ns, descontado o relógio: %lu ns) ---\n", (unsigned long) overhead_ns);
+    printf("  Cache fria: %zu KiB percorridos antes de cada chamada (última cache: %zu KiB)\n",
+           g_flush_bytes >> 10, llc >> 10);
+    printf("| Corpo                         | Cache  | Iterações |  Mínimo |    Média |     p50 |     p99 |   p99.9 |  p99.99 |   Máximo |\n");
+    printf("|-------------------------------|--------|-----------|---------|----------|---------|---------|---------|---------|----------|\n");
+    fprintf(csv, "corpo,cache,faixa_inicio_ns,faixa_fim_ns,contagem\n");
+
+    // 2. Cada corpo, quente e frio. O máximo bruto inclui preempções e
+    // interrupções do sistema; a estimativa usa os percentis altos.
+    double wcet_ns[NUM_BODIES];
+    for (int b = 0; b < NUM_BODIES; b++) {
+        Histogram warm, cold;
+        measure(&g_bodies[b], &fx, warm_iterations, 0, overhead_ns, &warm);
+        measure(&g_bodies[b], &fx, cold_iterations, 1, overhead_ns, &cold);
+        print_row(g_bodies[b].name, "quente", &warm);
+        print_row(g_bodies[b].name, "fria", &cold);
+        export_histogram(csv, g_bodies[b].name, "quente", &warm);
+        export_histogram(csv, g_bodies[b].name, "fria", &cold);
+        uint64_t warm_p = histogram_percentile(&warm, 99.99);
+        uint64_t cold_p = histogram_percentile(&cold, 99.9);
+        wcet_ns[b] = (double) (warm_p > cold_p ? warm_p : cold_p);
+    }
+    fclose(csv);
+
+    printf("\n--- Estimativa de WCET: max(p99.99 quente, p99.9 fria) ---\n");
+    for (int b = 0; b < NUM_BODIES; b++) {
+        printf("  - %-29s %10.3f us\n", g_bodies[b].name, wcet_ns[b] / 1e3);
+    }
+    printf("Histogramas completos salvos em %s\n", csv_filename);
+
+    free(g_flush_buffer);
+    free_reference_table(fx.table);
+    free_reference_trajectory(fx.reference);
+    free_ref_model(fx.ref_model);
+    free_controller(fx.controller);
+    free_robot_state(fx.robot);
+    return 0;
+}